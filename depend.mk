@@ -1,83 +1,95 @@
 # This file was generated by "make depend".
 #
 
-$(LIBAUDIO_ROOT)src/channelmap.o: $(LIBAUDIO_ROOT)src/channelmap.cc $(LIBALAC_ROOT)/ALACAudioTypes.h $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/channelmap.o: $(LIBAUDIO_ROOT)src/channelmap.cc $(LIBALAC_ROOT)/ALACAudioTypes.h $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codec.o: $(LIBAUDIO_ROOT)src/codec.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/id3.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/registrationlist.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codec.o: $(LIBAUDIO_ROOT)src/codec.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/sniff.h $(LIBAUDIO_ROOT)src/id3.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/registrationlist.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/conversion.o: $(LIBAUDIO_ROOT)src/conversion.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/conversion.o: $(LIBAUDIO_ROOT)src/conversion.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)src/enum.o: $(LIBAUDIO_ROOT)src/enum.cc $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/id3.o: $(LIBAUDIO_ROOT)src/id3.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/id3.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/utf.h
+$(LIBAUDIO_ROOT)src/id3.o: $(LIBAUDIO_ROOT)src/id3.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/id3.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/utf.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/microcodec.o: $(LIBAUDIO_ROOT)src/microcodec.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/microcodec.o: $(LIBAUDIO_ROOT)src/microcodec.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBAUDIO_ROOT)src/codecs/carryover.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/mixer.o: $(LIBAUDIO_ROOT)src/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/stackarray.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/mixer.o: $(LIBAUDIO_ROOT)src/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/stackarray.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)src/player.o: $(LIBAUDIO_ROOT)src/player.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioPlayer.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBAUDIO_ROOT)src/wakelock.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/ring.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/c++/worker.h $(LIBCOMMON_ROOT)include/common/cas.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h $(LIBCOMMON_ROOT)include/common/time.h $(LIBKISSFFT_ROOT)/kiss_fft.h $(LIBKISSFFT_ROOT)/tools/kiss_fftr.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/resample.o: $(LIBAUDIO_ROOT)src/resample.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBKISSFFT_ROOT)/../../third_party/libspeex-resample/speex_resampler.h
+$(LIBAUDIO_ROOT)src/resample.o: $(LIBAUDIO_ROOT)src/resample.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBKISSFFT_ROOT)/../../third_party/libspeex-resample/speex_resampler.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/source.o: $(LIBAUDIO_ROOT)src/source.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/source.o: $(LIBAUDIO_ROOT)src/source.cc $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)src/wakelock.o: $(LIBAUDIO_ROOT)src/wakelock.cc $(LIBAUDIO_ROOT)src/wakelock.h $(LIBCOMMON_ROOT)include/common/c++/lock.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/ring.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/worker.h $(LIBCOMMON_ROOT)include/common/cas.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/rwlock-self.h $(LIBCOMMON_ROOT)include/common/rwlock.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h $(LIBCOMMON_ROOT)include/common/waiter.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)src/winimport.o: $(LIBAUDIO_ROOT)src/winimport.cc $(LIBCOMMON_ROOT)include/common/error.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/adts.o: $(LIBAUDIO_ROOT)src/codecs/adts.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/adts.o: $(LIBAUDIO_ROOT)src/codecs/adts.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/sniff.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/alac.o: $(LIBAUDIO_ROOT)src/codecs/alac.cc $(LIBALAC_ROOT)/ALACAudioTypes.h $(LIBALAC_ROOT)/ALACBitUtilities.h $(LIBALAC_ROOT)/ALACDecoder.h $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/alac.o: $(LIBAUDIO_ROOT)src/codecs/alac.cc $(LIBALAC_ROOT)/ALACAudioTypes.h $(LIBALAC_ROOT)/ALACBitUtilities.h $(LIBALAC_ROOT)/ALACDecoder.h $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/coreaudio.o: $(LIBAUDIO_ROOT)src/codecs/coreaudio.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/coreaudio.o: $(LIBAUDIO_ROOT)src/codecs/coreaudio.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/flac.o: $(LIBAUDIO_ROOT)src/codecs/flac.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/FLAC/stream_decoder.h
+$(LIBAUDIO_ROOT)src/codecs/flac.o: $(LIBAUDIO_ROOT)src/codecs/flac.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/carryover.h $(LIBAUDIO_ROOT)src/codecs/decoderpool.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/FLAC/stream_decoder.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/mediafoundation.o: $(LIBAUDIO_ROOT)src/codecs/mediafoundation.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/mediafoundation.o: $(LIBAUDIO_ROOT)src/codecs/mediafoundation.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/mp4.o: $(LIBAUDIO_ROOT)src/codecs/mp4.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/mp4.o: $(LIBAUDIO_ROOT)src/codecs/mp4.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBAUDIO_ROOT)src/codecs/packedtable.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/ogg.o: $(LIBAUDIO_ROOT)src/codecs/ogg.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/ogg.o: $(LIBAUDIO_ROOT)src/codecs/ogg.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/opencore-aac.o: $(LIBAUDIO_ROOT)src/codecs/opencore-aac.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/e_tmp4audioobjecttype.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/pv_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/pvmp4audiodecoder_api.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+$(LIBAUDIO_ROOT)src/codecs/opencore-aac.o: $(LIBAUDIO_ROOT)src/codecs/opencore-aac.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)include/MicroCodec.h $(LIBAUDIO_ROOT)src/codecs/carryover.h $(LIBAUDIO_ROOT)src/codecs/decoderpool.h $(LIBAUDIO_ROOT)src/codecs/mpegheader.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBAUDIO_ROOT)src/codecs/syncscan.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/e_tmp4audioobjecttype.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/pv_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)aac/dec/include/pvmp4audiodecoder_api.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/opencore-amr.o: $(LIBAUDIO_ROOT)src/codecs/opencore-amr.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBKISSFFT_ROOT)/../../third_party/opencore-audio/gsm_amr/amr_nb/dec/src/gsmamr_dec.h $(OPENCORE_AUDIO_ROOT)gsm_amr/amr_nb/dec/include/pvamrnbdecoder_api.h $(OPENCORE_AUDIO_ROOT)gsm_amr/common/dec/include/pvgsmamrdecoderinterface.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+$(LIBAUDIO_ROOT)src/codecs/opencore-amr.o: $(LIBAUDIO_ROOT)src/codecs/opencore-amr.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBKISSFFT_ROOT)/../../third_party/opencore-audio/gsm_amr/amr_nb/dec/src/gsmamr_dec.h $(OPENCORE_AUDIO_ROOT)gsm_amr/amr_nb/dec/include/pvamrnbdecoder_api.h $(OPENCORE_AUDIO_ROOT)gsm_amr/common/dec/include/pvgsmamrdecoderinterface.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/opencore-mp3.o: $(LIBAUDIO_ROOT)src/codecs/opencore-mp3.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/../third_party/opencore-audio/mp3/dec/src/pvmp3_dec_defs.h $(LIBAUDIO_ROOT)src/../third_party/opencore-audio/mp3/dec/src/s_mp3bits.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBKISSFFT_ROOT)/../../third_party/opencore-audio/mp3/dec/src/pvmp3_framedecoder.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+$(LIBAUDIO_ROOT)src/codecs/opencore-mp3.o: $(LIBAUDIO_ROOT)src/codecs/opencore-mp3.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/../third_party/opencore-audio/mp3/dec/src/pvmp3_dec_defs.h $(LIBAUDIO_ROOT)src/../third_party/opencore-audio/mp3/dec/src/s_mp3bits.h $(LIBAUDIO_ROOT)src/codecs/carryover.h $(LIBAUDIO_ROOT)src/codecs/decoderpool.h $(LIBAUDIO_ROOT)src/codecs/mpegheader.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBAUDIO_ROOT)src/codecs/syncscan.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBKISSFFT_ROOT)/../../third_party/opencore-audio/mp3/dec/src/pvmp3_framedecoder.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/opusfile.o: $(LIBAUDIO_ROOT)src/codecs/opusfile.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBOGG_ROOT)include/ogg/config_types.h $(LIBOGG_ROOT)include/ogg/ogg.h $(LIBOGG_ROOT)include/ogg/os_types.h $(LIBOPUSFILE_ROOT)include/opusfile.h $(LIBOPUS_ROOT)include/opus.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_multistream.h $(LIBOPUS_ROOT)include/opus_types.h
+$(LIBAUDIO_ROOT)src/codecs/opusfile.o: $(LIBAUDIO_ROOT)src/codecs/opusfile.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBOGG_ROOT)include/ogg/config_types.h $(LIBOGG_ROOT)include/ogg/ogg.h $(LIBOGG_ROOT)include/ogg/os_types.h $(LIBOPUSFILE_ROOT)include/opusfile.h $(LIBOPUS_ROOT)include/opus.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_multistream.h $(LIBOPUS_ROOT)include/opus_types.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/seek.o: $(LIBAUDIO_ROOT)src/codecs/seek.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/time.h
+$(LIBAUDIO_ROOT)src/codecs/seek.o: $(LIBAUDIO_ROOT)src/codecs/seek.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/rollback.h $(LIBAUDIO_ROOT)src/codecs/seekbase.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/ring.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/c++/worker.h $(LIBCOMMON_ROOT)include/common/cas.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h $(LIBCOMMON_ROOT)include/common/time.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/vorbisfile.o: $(LIBAUDIO_ROOT)src/codecs/vorbisfile.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBOGG_ROOT)include/ogg/config_types.h $(LIBOGG_ROOT)include/ogg/ogg.h $(LIBOGG_ROOT)include/ogg/os_types.h $(LIBVORBIS_ROOT)include/vorbis/codec.h $(LIBVORBIS_ROOT)include/vorbis/vorbisfile.h
+$(LIBAUDIO_ROOT)src/codecs/sniff.o: $(LIBAUDIO_ROOT)src/codecs/sniff.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/mpegheader.h $(LIBAUDIO_ROOT)src/codecs/sniff.h $(LIBAUDIO_ROOT)src/codecs/syncscan.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/codecs/wav.o: $(LIBAUDIO_ROOT)src/codecs/wav.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/vorbisfile.o: $(LIBAUDIO_ROOT)src/codecs/vorbisfile.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)src/codecs/carryover.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBOGG_ROOT)include/ogg/config_types.h $(LIBOGG_ROOT)include/ogg/ogg.h $(LIBOGG_ROOT)include/ogg/os_types.h $(LIBVORBIS_ROOT)include/vorbis/codec.h $(LIBVORBIS_ROOT)include/vorbis/vorbisfile.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/alsa.o: $(LIBAUDIO_ROOT)src/dev/alsa.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/codecs/wav.o: $(LIBAUDIO_ROOT)src/codecs/wav.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/coreaudio.o: $(LIBAUDIO_ROOT)src/dev/coreaudio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/lock.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/rwlock-self.h $(LIBCOMMON_ROOT)include/common/rwlock.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h $(LIBCOMMON_ROOT)include/common/waiter.h
+$(LIBAUDIO_ROOT)src/dev/alsa.o: $(LIBAUDIO_ROOT)src/dev/alsa.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/devaudio.o: $(LIBAUDIO_ROOT)src/dev/devaudio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/devnodeenum.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBCOMMON_ROOT)include/common/trie.h
+$(LIBAUDIO_ROOT)src/dev/coreaudio.o: $(LIBAUDIO_ROOT)src/dev/coreaudio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/lock.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/rwlock-self.h $(LIBCOMMON_ROOT)include/common/rwlock.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h $(LIBCOMMON_ROOT)include/common/waiter.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/mixer.o: $(LIBAUDIO_ROOT)src/dev/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/dev/devaudio.o: $(LIBAUDIO_ROOT)src/dev/devaudio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/devnodeenum.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBCOMMON_ROOT)include/common/trie.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/oss.o: $(LIBAUDIO_ROOT)src/dev/oss.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/devnodeenum.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBCOMMON_ROOT)include/common/trie.h
+$(LIBAUDIO_ROOT)src/dev/mixer.o: $(LIBAUDIO_ROOT)src/dev/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/sndio.o: $(LIBAUDIO_ROOT)src/dev/sndio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/dev/oss.o: $(LIBAUDIO_ROOT)src/dev/oss.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/devnodeenum.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/size.h $(LIBCOMMON_ROOT)include/common/trie.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/wasapi.o: $(LIBAUDIO_ROOT)src/dev/wasapi.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/win.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/dev/sndio.o: $(LIBAUDIO_ROOT)src/dev/sndio.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/winmm.o: $(LIBAUDIO_ROOT)src/dev/winmm.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/win.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/uname.h
+$(LIBAUDIO_ROOT)src/dev/wasapi.o: $(LIBAUDIO_ROOT)src/dev/wasapi.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/win.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/dev/wrapper.o: $(LIBAUDIO_ROOT)src/dev/wrapper.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/dev/winmm.o: $(LIBAUDIO_ROOT)src/dev/winmm.cc $(LIBAUDIO_ROOT)include/AudioChannelLayout.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)src/dev/win.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/uname.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/test/list-devices.o: $(LIBAUDIO_ROOT)src/test/list-devices.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/dev/wrapper.o: $(LIBAUDIO_ROOT)src/dev/wrapper.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/test/mixer.o: $(LIBAUDIO_ROOT)src/test/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/streams/counting.o: $(LIBAUDIO_ROOT)src/streams/counting.cc $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/test/mute.o: $(LIBAUDIO_ROOT)src/test/mute.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/streams/mmap.o: $(LIBAUDIO_ROOT)src/streams/mmap.cc $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
-$(LIBAUDIO_ROOT)src/test/play.o: $(LIBAUDIO_ROOT)src/test/play.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioPlayer.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+$(LIBAUDIO_ROOT)src/streams/prefetch.o: $(LIBAUDIO_ROOT)src/streams/prefetch.cc $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBCOMMON_ROOT)include/common/c++/new.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/ring.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/c++/worker.h $(LIBCOMMON_ROOT)include/common/cas.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/misc.h $(LIBCOMMON_ROOT)include/common/mutex.h $(LIBCOMMON_ROOT)include/common/refcnt.h $(LIBCOMMON_ROOT)include/common/sem.h $(LIBCOMMON_ROOT)include/common/thread.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/decodetime.o: $(LIBAUDIO_ROOT)src/test/decodetime.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/iostats.o: $(LIBAUDIO_ROOT)src/test/iostats.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/list-devices.o: $(LIBAUDIO_ROOT)src/test/list-devices.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/mixer.o: $(LIBAUDIO_ROOT)src/test/mixer.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/mute.o: $(LIBAUDIO_ROOT)src/test/mute.cc $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)src/test/play.o: $(LIBAUDIO_ROOT)src/test/play.cc $(LIBAUDIO_ROOT)include/AudioCodec.h $(LIBAUDIO_ROOT)include/AudioDevice.h $(LIBAUDIO_ROOT)include/AudioPlayer.h $(LIBAUDIO_ROOT)include/AudioSource.h $(LIBAUDIO_ROOT)include/AudioStream.h $(LIBAUDIO_ROOT)include/AudioTags.h $(LIBAUDIO_ROOT)include/AudioTransform.h $(LIBCOMMON_ROOT)include/common/c++/event.h $(LIBCOMMON_ROOT)include/common/c++/refcount.h $(LIBCOMMON_ROOT)include/common/c++/scheduler.h $(LIBCOMMON_ROOT)include/common/c++/stream.h $(LIBCOMMON_ROOT)include/common/error.h $(LIBCOMMON_ROOT)include/common/logger.h $(LIBCOMMON_ROOT)include/common/refcnt.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(LIBAUDIO_CXXFLAGS) $(LIBAUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 # This file was generated by "make depend".
 #
@@ -103,6 +115,8 @@ $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_decoder.o: $(LIBAUD
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_dequantize_sample.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_dequantize_sample.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/mp3_mem_funcs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dequantize_sample.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_normalize.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_mem.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_dequantize_sample_simd.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_dequantize_sample_simd.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dequantize_sample.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_equalizer.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_equalizer.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_equalizer.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_framedecoder.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_framedecoder.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/mp3_mem_funcs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_alias_reduction.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_decode_header.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_decode_huff_cw.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dequantize_sample.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_framedecoder.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_get_main_data_size.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_get_scale_factors.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_get_side_info.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_getbits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_imdct_synth.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mpeg2_get_scale_factors.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mpeg2_stereo_proc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_poly_phase_synthesis.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_reorder.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_stereo_proc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_mem.h
@@ -123,6 +137,8 @@ $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_imdct_synth.o: $(LI
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_18.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_18.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mdct_18.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_18_simd.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_18_simd.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mdct_18.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mdct_18_lanes.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mdct_6.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_6.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mdct_6.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mdct_6.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mpeg2_get_scale_data.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_mpeg2_get_scale_data.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_getbits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_mpeg2_get_scale_data.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
@@ -137,6 +153,8 @@ $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_poly_phase_synthesi
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_polyphase_filter_window.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_polyphase_filter_window.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_polyphase_filter_window.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_polyphase_filter_window_simd.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_polyphase_filter_window_simd.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_polyphase_filter_window.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
+	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_reorder.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_reorder.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/mp3_mem_funcs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_reorder.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_mem.h
 	$(CXX) $(CXXFLAGS) $(CFLAGS) $(OPENCORE_AUDIO_CXXFLAGS) $(OPENCORE_AUDIO_CFLAGS) $(LATE_CXXFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_seek_synch.o: $(LIBAUDIO_ROOT)third_party/opencore-audio/mp3/dec/src/pvmp3_seek_synch.cpp $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3_audio_type_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/include/pvmp3decoder_api.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3_huffman.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_arm_gcc.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pv_mp3dec_fxd_op_c_equivalent.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_dec_defs.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_getbits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_seek_synch.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/pvmp3_tables.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_huffcodetab.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_mp3bits.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_chan.h $(OPENCORE_AUDIO_ROOT)mp3/dec/src/s_tmp3dec_file.h $(OPENCORE_AUDIO_ROOT)oscl/include/oscl_base.h
@@ -964,6 +982,8 @@ $(LIBAUDIO_ROOT)third_party/libopus/silk/float/find_pred_coefs_FLP.o: $(LIBAUDIO
 	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libopus/silk/float/inner_product_FLP.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/float/inner_product_FLP.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/float_cast.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/float/SigProc_FLP.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
 	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/float/x86/inner_product_FLP_avx2.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/float/x86/inner_product_FLP_avx2.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/float_cast.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/float/SigProc_FLP.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libopus/silk/float/k2a_FLP.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/float/k2a_FLP.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/float_cast.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/float/SigProc_FLP.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
 	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libopus/silk/float/LPC_analysis_filter_FLP.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/float/LPC_analysis_filter_FLP.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/float_cast.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/float/SigProc_FLP.h $(LIBOPUS_ROOT)silk/float/main_FLP.h $(LIBOPUS_ROOT)silk/float/structs_FLP.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
@@ -1040,6 +1060,52 @@ $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/vector_ops_FIX.o: $(LIBAUDIO_ROOT
 	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/warped_autocorrelation_FIX.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/warped_autocorrelation_FIX.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/fixed/arm/warped_autocorrelation_FIX_arm.h $(LIBOPUS_ROOT)silk/fixed/main_FIX.h $(LIBOPUS_ROOT)silk/fixed/mips/warped_autocorrelation_FIX_mipsr1.h $(LIBOPUS_ROOT)silk/fixed/structs_FIX.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
 	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse2.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse2.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/vq_sse2.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/vq_sse2.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/x86_celt_map.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/x86_celt_map.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/x86cpu.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/x86cpu.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/celt_lpc_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/celt_lpc_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_avx.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/x86/pitch_avx.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/arm/celt_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/arm/celt_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/celt/arm/pitch_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/celt/arm/pitch_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mathops_arm.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/celt_lpc.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mathops.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/celt_lpc_sse.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/x86_silk_map.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/x86_silk_map.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_del_dec_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_del_dec_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_del_dec_avx2.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_del_dec_avx2.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/NSQ_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/VAD_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/VAD_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/x86/VQ_WMat_EC_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/x86/VQ_WMat_EC_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/arm/biquad_alt_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/arm/biquad_alt_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/arm/LPC_inv_pred_gain_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/arm/LPC_inv_pred_gain_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/arm/NSQ_del_dec_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/arm/NSQ_del_dec_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/arm/NSQ_neon.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/arm/NSQ_neon.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/os_support.h $(LIBOPUS_ROOT)celt/stack_alloc.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/NSQ.h $(LIBOPUS_ROOT)silk/PLC.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_del_dec_arm.h $(LIBOPUS_ROOT)silk/arm/NSQ_neon.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/control.h $(LIBOPUS_ROOT)silk/debug.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/main.h $(LIBOPUS_ROOT)silk/mips/NSQ_mips.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/structs.h $(LIBOPUS_ROOT)silk/tables.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/x86/main_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/x86/burg_modified_FIX_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/x86/burg_modified_FIX_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/tuning_parameters.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/x86/vector_ops_FIX_sse4_1.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/x86/vector_ops_FIX_sse4_1.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/tuning_parameters.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/arm/warped_autocorrelation_FIX_neon_intr.o: $(LIBAUDIO_ROOT)third_party/libopus/silk/fixed/arm/warped_autocorrelation_FIX_neon_intr.c $(LIBOPUS_ROOT)celt/arch.h $(LIBOPUS_ROOT)celt/arm/armcpu.h $(LIBOPUS_ROOT)celt/arm/fft_arm.h $(LIBOPUS_ROOT)celt/arm/fixed_arm64.h $(LIBOPUS_ROOT)celt/arm/fixed_armv4.h $(LIBOPUS_ROOT)celt/arm/fixed_armv5e.h $(LIBOPUS_ROOT)celt/arm/mdct_arm.h $(LIBOPUS_ROOT)celt/arm/pitch_arm.h $(LIBOPUS_ROOT)celt/celt.h $(LIBOPUS_ROOT)celt/cpu_support.h $(LIBOPUS_ROOT)celt/ecintrin.h $(LIBOPUS_ROOT)celt/entcode.h $(LIBOPUS_ROOT)celt/entdec.h $(LIBOPUS_ROOT)celt/entenc.h $(LIBOPUS_ROOT)celt/fixed_c5x.h $(LIBOPUS_ROOT)celt/fixed_c6x.h $(LIBOPUS_ROOT)celt/fixed_debug.h $(LIBOPUS_ROOT)celt/fixed_generic.h $(LIBOPUS_ROOT)celt/kiss_fft.h $(LIBOPUS_ROOT)celt/mdct.h $(LIBOPUS_ROOT)celt/mips/fixed_generic_mipsr1.h $(LIBOPUS_ROOT)celt/mips/pitch_mipsr1.h $(LIBOPUS_ROOT)celt/modes.h $(LIBOPUS_ROOT)celt/pitch.h $(LIBOPUS_ROOT)celt/x86/pitch_sse.h $(LIBOPUS_ROOT)celt/x86/x86cpu.h $(LIBOPUS_ROOT)include/opus_custom.h $(LIBOPUS_ROOT)include/opus_defines.h $(LIBOPUS_ROOT)include/opus_types.h $(LIBOPUS_ROOT)silk/Inlines.h $(LIBOPUS_ROOT)silk/MacroCount.h $(LIBOPUS_ROOT)silk/MacroDebug.h $(LIBOPUS_ROOT)silk/SigProc_FIX.h $(LIBOPUS_ROOT)silk/arm/LPC_inv_pred_gain_arm.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv4.h $(LIBOPUS_ROOT)silk/arm/SigProc_FIX_armv5e.h $(LIBOPUS_ROOT)silk/arm/biquad_alt_arm.h $(LIBOPUS_ROOT)silk/arm/macros_arm64.h $(LIBOPUS_ROOT)silk/arm/macros_armv4.h $(LIBOPUS_ROOT)silk/arm/macros_armv5e.h $(LIBOPUS_ROOT)silk/define.h $(LIBOPUS_ROOT)silk/errors.h $(LIBOPUS_ROOT)silk/macros.h $(LIBOPUS_ROOT)silk/mips/macros_mipsr1.h $(LIBOPUS_ROOT)silk/mips/sigproc_fix_mipsr1.h $(LIBOPUS_ROOT)silk/resampler_structs.h $(LIBOPUS_ROOT)silk/tuning_parameters.h $(LIBOPUS_ROOT)silk/typedef.h $(LIBOPUS_ROOT)silk/x86/SigProc_FIX_sse.h $(LIBOPUS_ROOT)silk/xtensa/SigProc_FIX_lx7.h $(LIBOPUS_ROOT)silk/xtensa/macros_lx7.h
+	$(CC) $(CFLAGS) $(LIBOPUS_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 # This file was generated by "make depend".
 #
 
@@ -1111,10 +1177,28 @@ $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/crc.o: $(LIBAUDIO_ROOT)third_par
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/macros.h
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_avx2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_avx2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_sse2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_sse2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_sse42.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_sse42.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_ssse3.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/fixed_intrin_ssse3.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/format.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/format.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/alloc.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/format.h $(LIBFLAC_ROOT)/include/private/macros.h
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h $(LIBFLAC_ROOT)deduplication/lpc_compute_autocorrelation_intrin.c
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_avx2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_avx2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_fma.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_fma.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_neon.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_neon.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_sse2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_sse2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_sse41.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/lpc_intrin_sse41.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/md5.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/md5.c $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/alloc.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/endswap.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/md5.h
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/memory.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/memory.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/alloc.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/memory.h
@@ -1137,6 +1221,12 @@ $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_framing.o: $(LIBA
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/FLAC/stream_decoder.h $(LIBFLAC_ROOT)/../../include/FLAC/stream_encoder.h $(LIBFLAC_ROOT)/../../include/share/alloc.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/private.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/bitwriter.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/crc.h $(LIBFLAC_ROOT)/include/private/fixed.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/format.h $(LIBFLAC_ROOT)/include/private/lpc.h $(LIBFLAC_ROOT)/include/private/macros.h $(LIBFLAC_ROOT)/include/private/md5.h $(LIBFLAC_ROOT)/include/private/memory.h $(LIBFLAC_ROOT)/include/private/ogg_encoder_aspect.h $(LIBFLAC_ROOT)/include/private/ogg_helper.h $(LIBFLAC_ROOT)/include/private/ogg_mapping.h $(LIBFLAC_ROOT)/include/private/stream_encoder.h $(LIBFLAC_ROOT)/include/private/stream_encoder_framing.h $(LIBFLAC_ROOT)/include/private/window.h $(LIBFLAC_ROOT)/include/protected/stream_encoder.h $(LIBOGG_ROOT)/include/ogg/config_types.h $(LIBOGG_ROOT)/include/ogg/ogg.h $(LIBOGG_ROOT)/include/ogg/os_types.h
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_avx2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_avx2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/macros.h $(LIBFLAC_ROOT)/include/private/stream_encoder.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_sse2.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_sse2.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/macros.h $(LIBFLAC_ROOT)/include/private/stream_encoder.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
+$(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_ssse3.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/stream_encoder_intrin_ssse3.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/bitmath.h $(LIBFLAC_ROOT)/include/private/cpu.h $(LIBFLAC_ROOT)/include/private/macros.h $(LIBFLAC_ROOT)/include/private/stream_encoder.h
+	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/window.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/window.c $(LIBFLAC_ROOT)/../../include/FLAC/assert.h $(LIBFLAC_ROOT)/../../include/FLAC/export.h $(LIBFLAC_ROOT)/../../include/FLAC/format.h $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/compat.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h $(LIBFLAC_ROOT)/include/private/float.h $(LIBFLAC_ROOT)/include/private/window.h
 	$(CC) $(CFLAGS) $(LIBFLAC_CFLAGS) $(LATE_CFLAGS) -c -o $@ $<
 $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/../share/win_utf8_io/win_utf8_io.o: $(LIBAUDIO_ROOT)third_party/libflac/src/libFLAC/../share/win_utf8_io/win_utf8_io.c $(LIBFLAC_ROOT)/../../include/FLAC/ordinals.h $(LIBFLAC_ROOT)/../../include/share/win_utf8_io.h
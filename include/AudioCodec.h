@@ -15,8 +15,11 @@
 #define audiocodec_h_
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "AudioSource.h"
+#include "AudioStream.h"
 #include "AudioTags.h"
 
 namespace audio {
@@ -35,6 +38,66 @@ struct SeekTable
    }
 };
 
+// A seek table that a codec fills in as it walks frames, eg. while it
+// counts up the duration of a VBR MP3 with no Xing or VBRI header.  It
+// remembers the time and offset of every Nth frame.
+//
+// If the caller hangs on to this (for example, by writing Serialize()'s
+// output to a cache keyed on the file), the next open of the same file
+// can pass it back through CodecArgs and skip the scan entirely.
+//
+// A background duration scan fills this in on its own thread, so all of
+// the methods lock.
+//
+struct FrameIndexSeekTable : public SeekTable
+{
+   FrameIndexSeekTable(int framesPerEntry = 32);
+
+   bool
+   Lookup(uint64_t desiredTime, uint64_t &time, uint64_t &fileOffset, error *err);
+
+   // Called by the codec for each frame it walks past.  The offset
+   // is in the same terms as the codec's other seek tables.
+   //
+   void OnFrame(uint64_t time, uint64_t fileOffset, error *err);
+
+   // Called when a scan reaches the end of the stream.
+   //
+   void SetDuration(uint64_t duration);
+
+   // Returns 0 if no scan has made it to the end.
+   //
+   uint64_t GetDuration(void) const;
+
+   // Called by the codec with the file and where its frames start.  If
+   // the index was built for a different file, or for this one before it
+   // changed (eg. was re-tagged), it is emptied and bound to this one
+   // instead.  Returns false if that happened.
+   //
+   bool Bind(common::Stream *file, uint64_t dataOffset, error *err);
+
+   void Serialize(std::vector<unsigned char> &buf, error *err);
+
+   // Fails if @buf was serialized from an index on a file of some other
+   // size than @fileSize.
+   //
+   void Deserialize(const void *buf, size_t len, uint64_t fileSize, error *err);
+
+private:
+   struct Entry
+   {
+      uint64_t Time;
+      uint64_t FileOffset;
+   };
+   mutable std::mutex lock;
+   std::vector<Entry> entries;
+   int framesPerEntry;
+   int framesSinceEntry;
+   uint64_t duration;
+   uint64_t fileSize;
+   uint64_t dataOffset;
+};
+
 // Hints that the caller can provide, eg. from a container or stream
 // implementation.
 //
@@ -44,12 +107,53 @@ struct CodecArgs
    MetadataReceiver *Metadata;
    std::shared_ptr<SeekTable> SeekTable;
 
+   // FrameIndex, DurationStream and Mapping all describe the stream
+   // handed to OpenCodec().  A container passing some other stream to an
+   // inner codec has to clear them.
+   //
+
+   // If provided, codecs that have to walk frames to find the duration
+   // will record into this, or use it in place of walking if it is
+   // already complete.
+   //
+   std::shared_ptr<FrameIndexSeekTable> FrameIndex;
+
+   // A second stream on the same file, with its own cursor.  If provided,
+   // codecs that have to walk frames to find the duration do it on this,
+   // on another thread, and GetDuration() doesn't block.
+   //
+   common::Pointer<common::Stream> DurationStream;
+
+   // If the stream is a file mapped into memory, from CreateFileStream(),
+   // where it is.  Codecs can parse from here rather than read.
+   //
+   StreamMapping Mapping;
+
    CodecArgs() : Duration(0), Metadata(nullptr) {}
 };
 
+// What OpenCodec's sniffer makes of the first bytes of a file.
+//
+enum FileType
+{
+   FileTypeUnknown,
+   FileTypeMp4,
+   FileTypeOgg,
+   FileTypeFlac,
+   FileTypeWav,
+   FileTypeAmr,
+   FileTypeMpegAudio,
+};
+
 struct Codec : public RefCountable
 {
    virtual int GetBytesRequiredForDetection() { return 0; }
+
+   // The one type of file this codec opens.  Codecs that leave this as
+   // FileTypeUnknown, such as platform decoders, are offered every file.
+   //
+   virtual FileType GetFileType() { return FileTypeUnknown; }
+
    virtual void TryOpen(
       common::Stream *file,
       const void *firstBuffer,
@@ -64,7 +168,8 @@ struct Codec : public RefCountable
 //
 void RegisterCodecs(void);
 
-// Enumerate registered codec objects and call ->TryOpen to get a source.
+// Sniff the start of the file, then call ->TryOpen on the registered
+// codec objects that handle what we found, to get a source.
 //
 void OpenCodec(
    common::Stream *file,
@@ -22,6 +22,7 @@
 namespace audio {
 
 struct PlayerVisState;
+struct PlayerDurationState;
 
 struct VisualizationArgs
 {
@@ -48,6 +49,7 @@ class Player : public RefCountable
    int bufsz;
    uint64_t pos;
    PlayerVisState *visState;
+   std::shared_ptr<PlayerDurationState> durationState;
    AudioTransformStack transforms;
    common::Pointer<common::RefCountable> wakeLock;
    void ProcessVis(const void *buf, int len);
@@ -86,7 +88,9 @@ public:
 
    // Duration in 100ns units.
    // XXX: for streaming, this will block until the container knows
-   //      how long.  Needs to be addressed at AudioSource layer.
+   //      how long, unless the source was opened with
+   //      CodecArgs::DurationStream.  Then it is the latest estimate
+   //      from Source::DurationRefined.
    //
    uint64_t GetDuration(error *err);
 
@@ -9,6 +9,7 @@
 #ifndef audiosource_h_
 #define audiosource_h_
 
+#include <common/c++/event.h>
 #include <common/c++/refcount.h>
 #include <common/c++/stream.h>
 #include <functional>
@@ -126,16 +127,29 @@ struct Source : public RefCountable
    //
    virtual int Read(void *buf, int len, error *err) = 0;
 
+   // Ask for a different sample format than the one GetMetadata()
+   // reports, eg. float if that is what the rest of the chain wants.
+   // Returns false and changes nothing if the source can't do that.
+   //
+   virtual bool SetFormat(Format format, error *err) { return false; }
+
    // @pos: time in 100ns units
    //
    virtual void Seek(uint64_t pos, error *err) = 0;
 
    // Get stream duration in 100ns units.
    // TBD: what to do for streaming formats.  Currently, we block until
-   // a size can be known.
+   // a size can be known.  Sources opened with CodecArgs::DurationStream
+   // instead return an estimate until a background scan is done.
    //
    virtual uint64_t GetDuration(error *err) = 0;
 
+   // Fires with a better duration estimate as a background scan makes
+   // progress, and once more when it is exact.  This is called from the
+   // scan's thread.
+   //
+   common::Event<uint64_t> DurationRefined;
+
    // Current playback position (i.e. how much as been through Read())
    // in 100ns units.
    //
@@ -0,0 +1,122 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef audiostream_h_
+#define audiostream_h_
+
+#include <common/c++/stream.h>
+#include <common/error.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <memory>
+
+namespace audio {
+
+//
+// Streams for a file on its way to OpenCodec().  Codecs don't need to
+// know they are there.
+//
+
+// Where a file sits in memory, if CreateFileStream() mapped it.  Valid
+// for as long as the stream it came with.
+//
+struct StreamMapping
+{
+   const void *Data;
+   uint64_t Size;
+
+   StreamMapping() : Data(nullptr), Size(0) {}
+};
+
+// Like common::CreateStream(), but a regular file gets mapped into
+// memory, so reads are copies out of the page cache rather than stdio
+// calls, and the kernel is told to read ahead.  Anything that can't be
+// mapped, or a platform without mmap(), gets common::CreateStream().
+// On success @f belongs to the stream.
+//
+// If @mapping is non-null, it says where the file was mapped, or is left
+// empty if it wasn't.  Pass it on to OpenCodec() in CodecArgs::Mapping.
+//
+// As with any mapping, a file that shrinks underneath us can take the
+// process down, so this is for local files that aren't being written.
+//
+void
+CreateFileStream(
+   FILE *f,
+   common::Stream **out,
+   StreamMapping *mapping,
+   error *err
+);
+
+// Keeps up to @windowSize bytes ahead of the read position buffered, from
+// a thread of its own, so that a slow disk or network share stalls that
+// thread instead of the player.  Reads that carry on from the last one
+// are copies out of memory; a seek outside what's buffered sends the
+// read-ahead there instead.  @windowSize of 0 picks a default.
+//
+// Once wrapped, @stream belongs to the wrapper's thread.  Don't use it
+// directly any more.
+//
+void
+CreatePrefetchStream(
+   common::Stream *stream,
+   size_t windowSize,
+   common::Stream **out,
+   error *err
+);
+
+// What a stream wrapped by CreateCountingStream() has been asked to do.
+//
+struct StreamStats
+{
+   static const int ReadSizeBuckets = 21;
+
+   uint64_t Reads;
+   uint64_t Seeks;
+   uint64_t BytesRead;
+
+   // Reads by the size asked for.  Bucket i counts sizes from 2^i up to
+   // 2^(i+1)-1 bytes, except that the first also has empty reads and the
+   // last has everything too big for the others.
+   //
+   uint64_t ReadSizes[ReadSizeBuckets];
+
+   // Time spent in the wrapped stream's Read() and Seek(), in 100ns
+   // units.
+   //
+   uint64_t TimeBlocked;
+
+   StreamStats() { Reset(); }
+
+   void
+   Reset(void)
+   {
+      Reads = Seeks = BytesRead = TimeBlocked = 0;
+      for (auto &n : ReadSizes)
+         n = 0;
+   }
+};
+
+// Passes everything through to @stream, and counts reads and seeks into
+// @stats as they go by, for finding out how a codec uses its file.  Not
+// for use from more than one thread at a time, same as any stream.
+//
+void
+CreateCountingStream(
+   common::Stream *stream,
+   const std::shared_ptr<StreamStats> &stats,
+   common::Stream **out,
+   error *err
+);
+
+} // end namespace
+
+#endif
@@ -13,6 +13,7 @@
 //
 
 #ifndef micro_codec_h_
+#define micro_codec_h_
 
 #include "AudioSource.h"
 
@@ -26,7 +27,12 @@ struct MicroCodec : public common::RefCountable
       error *err
    ) = 0;
    virtual const char *Describe() { return nullptr; }
+
+   // Can change after the first Decode(), for codecs that only find the
+   // real format in the first frame.
+   //
    virtual void GetMetadata(Metadata *md, error *err) = 0;
+
    virtual int Decode(
       const void *samples,
       int samplesNBytes,
@@ -36,15 +42,41 @@ struct MicroCodec : public common::RefCountable
    ) = 0;
 };
 
-struct MicroCodecDemux
+//
+// One compressed frame, as the container stores it.  Data belongs to the
+// demuxer and is good until its next call.  Times are in 100ns units.
+//
+struct Packet
+{
+   const void *Data;
+   uint32_t Size;
+   uint64_t Duration;
+   uint64_t Timestamp;
+};
+
+//
+// Hands out a container's packets one at a time, with their timing, so
+// that a codec never has to find frame boundaries in a byte stream.
+//
+struct PacketDemuxer : public common::RefCountable
 {
-   uint32_t FrameSize, Duration;
+   // Returns false at end of stream.
+   //
+   virtual bool ReadPacket(Packet &packet, error *err) = 0;
+
+   // Position on the packet that holds @time.  @actualTime gets the
+   // time where that packet starts.
+   //
+   virtual void SeekPacket(uint64_t time, uint64_t &actualTime, error *err) = 0;
+
+   virtual uint64_t GetDuration(error *err) = 0;
+   virtual void GetStreamInfo(common::StreamInfo *info, error *err) = 0;
 };
 
 void
 AudioSourceFromMicroCodec(
    MicroCodec *codec,
-   common::Stream *demuxer,
+   PacketDemuxer *demuxer,
    uint64_t duration,
    const void *config,
    int nbytes,
@@ -58,6 +90,12 @@ CreateAlacCodec(
    error *err
 );
 
+void
+CreateOpenCoreAacMicroCodec(
+   MicroCodec **out,
+   error *err
+);
+
 } // end namespace
 
 #endif
@@ -12,6 +12,7 @@
 #include <common/c++/registrationlist.h>
 
 #include "id3.h"
+#include "codecs/sniff.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -32,11 +33,13 @@ void audio::RegisterCodec(Codec *codec, error *err)
 void audio::OpenCodec(Stream *file, CodecArgs *params, Source **obj, error *err)
 {
    int n = 0;
-   void *start = nullptr;
+   void *buffer = nullptr;
+   const void *start = nullptr;
    Pointer<Source> newObject;
    bool id3Checked = false;
    uint64_t origin = 0;
    CodecArgs paramsStorage;
+   FileType type = FileTypeUnknown;
 
    if (!params)
    {
@@ -58,16 +61,28 @@ void audio::OpenCodec(Stream *file, CodecArgs *params, Source **obj, error *err)
    n += 8192;
 
 retry:
-   if (n)
+   if (n && params->Mapping.Data && origin < params->Mapping.Size)
    {
-      if (!start)
-         start = malloc(n);
-      if (!start)
+      // Already in memory, so nothing to read.
+      //
+      start = (const char*)params->Mapping.Data + origin;
+      n = MIN((uint64_t)n, params->Mapping.Size - origin);
+
+      file->Seek(origin, SEEK_SET, err);
+      ERROR_CHECK(err);
+   }
+   else if (n)
+   {
+      if (!buffer)
+         buffer = malloc(n);
+      if (!buffer)
          ERROR_SET(err, nomem);
 
-      n = file->Read(start, n, err);
+      n = file->Read(buffer, n, err);
       ERROR_CHECK(err);
 
+      start = buffer;
+
       file->Seek(origin, SEEK_SET, err);
       ERROR_CHECK(err);
    }
@@ -106,27 +121,65 @@ retry:
       ERROR_CHECK(err);
    }
 
-   codecList.TryLoad(
-      file,
-      newObject.GetAddressOf(),
-      [&] (Codec *codec, Source **newObject, error *err) -> void
+   // One look at the buffer tells us who to ask first, so codecs for other
+   // kinds of files usually never see it.
+   //
+   type = SniffFileType(start, n);
+
+   // But the sniffer only sees the container.  A RIFF/WAVE file with an
+   // MP3 payload (format tag 0x55) sniffs as WAV, and it is the MPEG
+   // audio codec that can play it.  So if everything for the sniffed type
+   // turns it down, the codecs for other types get a turn before we give
+   // up.
+   //
+   for (int pass = 0; pass < 2 && !newObject.Get(); ++pass)
+   {
+      bool fallback = (pass != 0);
+
+      if (fallback)
       {
-         if (n < codec->GetBytesRequiredForDetection())
-            goto exit;
+         if (type == FileTypeUnknown)
+            break;
 
-         codec->TryOpen(file, start, n, *params, newObject, err);
+         file->Seek(origin, SEEK_SET, err);
          ERROR_CHECK(err);
-      exit:;
-      },
-      err
-   );
-   ERROR_CHECK(err);
+      }
+
+      codecList.TryLoad(
+         file,
+         newObject.GetAddressOf(),
+         [&] (Codec *codec, Source **newObject, error *err) -> void
+         {
+            auto codecType = codec->GetFileType();
+
+            // First pass: the sniffed type, and codecs that take anything.
+            // Second pass: everything the first pass skipped.
+            //
+            if (codecType == FileTypeUnknown || codecType == type)
+            {
+               if (fallback)
+                  goto exit;
+            }
+            else if (!fallback)
+               goto exit;
+
+            if (n < codec->GetBytesRequiredForDetection())
+               goto exit;
+
+            codec->TryOpen(file, start, n, *params, newObject, err);
+            ERROR_CHECK(err);
+         exit:;
+         },
+         err
+      );
+      ERROR_CHECK(err);
+   }
 
    if (!newObject.Get())
       ERROR_SET(err, unknown, "Could not find codec object.");
 exit:
    if (ERROR_FAILED(err)) newObject = nullptr;
-   free(start);
+   free(buffer);
    *obj = newObject.Detach();
 }
 
@@ -10,6 +10,8 @@
 #include <common/misc.h>
 #include <common/c++/new.h>
 
+#include "sniff.h"
+
 #include <errno.h>
 
 using namespace common;
@@ -19,6 +21,8 @@ namespace {
 
 struct AdtsProbe : public Codec
 {
+   FileType GetFileType() { return FileTypeMpegAudio; }
+
    void TryOpen(
       common::Stream *file,
       const void *firstBuffer,
@@ -32,67 +36,65 @@ struct AdtsProbe : public Codec
       Pointer<Codec> codecs[2];
       enum { Mp3, Aac };
       const unsigned char *p = (const unsigned char *)firstBuffer;
-      int off = 0;
+      MpegFrameRun run;
+      uint64_t origin = 0;
 
-      for (; firstBufferSize >= 4; ++off, ++p, --firstBufferSize)
-      {
-         if (p[0] == 0xff && (p[1] & 0xe0) == 0xe0)
-         {
-            bool mpg25 = (p[1] & 0xf0) == 0xe0;
-            int layer = 4 - ((p[1] >> 1) & 3);
-            Codec **codec = nullptr;
+      origin = file->GetPosition(err);
+      ERROR_CHECK(err);
 
-            if (mpg25 && layer != 3)
-               continue;
+      // Only go to a decoder where frame headers chain together, rather
+      // than at every sync word.
+      //
+      for (run.Offset = -1;
+           FindMpegFrameRun(p, firstBufferSize, run.Offset + 1, run);
+          )
+      {
+         Codec **codec = nullptr;
 
-            if (layer == 4)
-            {
-               codec = codecs[Aac].GetAddressOf();
+         if (run.Adts)
+         {
+            codec = codecs[Aac].GetAddressOf();
 #ifdef USE_OPENCORE_AAC
-               if (!*codec)
-               {
-                  CreateOpenCoreAacCodec(codec, err);
-                  ERROR_CHECK(err);
-               }
-#endif
-            }
-            else
+            if (!*codec)
             {
-               codec = codecs[Mp3].GetAddressOf();
-#ifdef USE_OPENCORE_MP3
-               if (!*codec)
-               {
-                  CreateOpenCoreMp3Codec(codec, err);
-                  ERROR_CHECK(err);
-               }
-#endif
+               CreateOpenCoreAacCodec(codec, err);
+               ERROR_CHECK(err);
             }
-
-            if (*codec)
+#endif
+         }
+         else
+         {
+            codec = codecs[Mp3].GetAddressOf();
+#ifdef USE_OPENCORE_MP3
+            if (!*codec)
             {
-               if (off)
-               {
-                  file->Seek(off, SEEK_CUR, err);
-                  ERROR_CHECK(err);
-                  off = 0;
-               }
-               (*codec)->TryOpen(
-                  file,
-                  p,
-                  firstBufferSize,
-                  params,
-                  r.GetAddressOf(),
-                  err  
-               );
-               if (ERROR_FAILED(err))
-               {
-                  error_clear(err);
-                  r = nullptr;
-               }
-               if (r.Get())
-                  goto exit;
+               CreateOpenCoreMp3Codec(codec, err);
+               ERROR_CHECK(err);
             }
+#endif
+         }
+
+         if (!*codec)
+            continue;
+
+         file->Seek(origin + run.Offset, SEEK_SET, err);
+         ERROR_CHECK(err);
+
+         (*codec)->TryOpen(
+            file,
+            p + run.Offset,
+            firstBufferSize - run.Offset,
+            params,
+            r.GetAddressOf(),
+            err
+         );
+         if (ERROR_FAILED(err))
+         {
+            error_clear(err);
+            r = nullptr;
          }
+         if (r.Get())
+            goto exit;
       }
 
    exit:
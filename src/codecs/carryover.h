@@ -0,0 +1,129 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef carryover_h_
+#define carryover_h_
+
+#include <common/error.h>
+#include <common/misc.h>
+
+#include <string.h>
+#include <vector>
+
+namespace audio {
+
+//
+// For decoders that only know how to produce whole frames: when the
+// caller's buffer has less room than a frame, the frame is decoded here
+// instead and handed out over the next few reads.
+//
+class CarryOver
+{
+   std::vector<unsigned char> buffer;
+   size_t offset;
+   uint64_t duration;
+public:
+   CarryOver() : offset(0), duration(0) {}
+
+   bool Empty(void) const { return offset == buffer.size(); }
+
+   void Clear(void)
+   {
+      buffer.clear();
+      offset = 0;
+   }
+
+   // Get space to decode a frame of up to @len bytes, which is
+   // @duration long in 100ns units.
+   //
+   void *
+   Prepare(size_t len, uint64_t duration, error *err)
+   {
+      void *r = nullptr;
+      try
+      {
+         buffer.resize(len);
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+      offset = 0;
+      this->duration = duration;
+      r = buffer.data();
+   exit:
+      return r;
+   }
+
+   // Get @len more bytes of space at the end, for decoders that hand us
+   // a whole frame at once and only part of it fit.
+   //
+   void *
+   Extend(size_t len, error *err)
+   {
+      void *r = nullptr;
+      size_t oldLen = 0;
+
+      if (offset)
+      {
+         buffer.erase(buffer.begin(), buffer.begin() + offset);
+         offset = 0;
+      }
+      oldLen = buffer.size();
+      try
+      {
+         buffer.resize(oldLen + len);
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+      r = buffer.data() + oldLen;
+   exit:
+      return r;
+   }
+
+   // After decoding, the number of bytes that were actually produced.
+   //
+   void SetLength(size_t len)
+   {
+      if (len < buffer.size())
+      {
+         if (buffer.size())
+            duration = duration * len / buffer.size();
+         buffer.resize(len);
+      }
+   }
+
+   // Copy as much as fits, advancing @buf and @len.
+   //
+   int
+   Drain(void *&buf, int &len)
+   {
+      int n = MIN((size_t)len, buffer.size() - offset);
+      memcpy(buf, buffer.data() + offset, n);
+      offset += n;
+      buf = (char*)buf + n;
+      len -= n;
+      return n;
+   }
+
+   // How much time is left to be handed out, in 100ns units.
+   //
+   uint64_t
+   GetRemainingDuration(void) const
+   {
+      if (!buffer.size())
+         return 0;
+      return duration * (buffer.size() - offset) / buffer.size();
+   }
+};
+
+} // end namespace
+
+#endif
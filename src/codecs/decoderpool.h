@@ -0,0 +1,72 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef decoderpool_h_
+#define decoderpool_h_
+
+#include <mutex>
+
+namespace audio {
+
+//
+// Decoder state that a source would otherwise free when it closes, kept
+// for the next source of the same kind.  Skipping through a playlist or
+// scanning a library opens and closes a lot of sources, and this saves
+// allocating (and faulting in) a decoder's memory each time.
+//
+// Whatever goes back in must be ready to be initialized again; the caller
+// still does its usual init on what comes out.  Beyond MaxItems, Put()
+// just hands things to Destroy.
+//
+// Sources can be released during static destruction, so a pool should
+// be created with new and never freed, rather than be a plain static.
+//
+template <class T, void (*Destroy)(T *), int MaxItems = 4>
+class DecoderPool
+{
+   std::mutex lock;
+   T *items[MaxItems];
+   int count;
+
+public:
+   DecoderPool() : count(0) {}
+
+   DecoderPool(const DecoderPool &) = delete;
+   DecoderPool &operator=(const DecoderPool &) = delete;
+
+   // Returns nullptr if the pool is empty, and the caller makes its own.
+   //
+   T *
+   Get(void)
+   {
+      std::lock_guard<std::mutex> l(lock);
+      return count ? items[--count] : nullptr;
+   }
+
+   void
+   Put(T *p)
+   {
+      if (!p)
+         return;
+
+      {
+         std::lock_guard<std::mutex> l(lock);
+         if (count < MaxItems)
+         {
+            items[count++] = p;
+            return;
+         }
+      }
+
+      Destroy(p);
+   }
+};
+
+} // end namespace
+
+#endif
@@ -12,17 +12,257 @@
 #include <common/logger.h>
 #include <common/c++/new.h>
 
+#include "carryover.h"
+#include "decoderpool.h"
+
 using namespace common;
 using namespace audio;
 
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 #include <FLAC/stream_decoder.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace {
 
+//
+// Writers for turning libFLAC's planar int32 output into interleaved PCM.
+// 16 and 24 bit are the common cases and get loops specialized on the
+// channel count; anything else is scaled to the nearest of those.
+//
+
+int
+GetOutputSampleSize(int bps)
+{
+   return bps <= 16 ? 2 : 3;
+}
+
+inline bool
+IsLittleEndian(void)
+{
+   static const int le = 1;
+   return *(const char*)&le;
+}
+
+inline void
+Store24(unsigned char *p, int32_t sample)
+{
+   if (IsLittleEndian())
+   {
+      p[0] = sample;
+      p[1] = sample >> 8;
+      p[2] = sample >> 16;
+   }
+   else
+   {
+      p[0] = sample >> 16;
+      p[1] = sample >> 8;
+      p[2] = sample;
+   }
+}
+
+void
+Interleave16(
+   const FLAC__int32 * const buffer[],
+   int channels,
+   int start,
+   int n,
+   void *dst
+)
+{
+   auto out = (int16_t*)dst;
+   int i = 0;
+
+   switch (channels)
+   {
+   case 1:
+      {
+         auto m = buffer[0] + start;
+#if defined(__SSE2__)
+         for (; i + 8 <= n; i += 8)
+         {
+            __m128i a = _mm_loadu_si128((const __m128i*)(m + i));
+            __m128i b = _mm_loadu_si128((const __m128i*)(m + i + 4));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(a, b));
+         }
+#elif defined(__ARM_NEON)
+         for (; i + 4 <= n; i += 4)
+            vst1_s16(out + i, vmovn_s32(vld1q_s32(m + i)));
+#endif
+         for (; i < n; ++i)
+            out[i] = m[i];
+      }
+      break;
+   case 2:
+      {
+         auto l = buffer[0] + start;
+         auto r = buffer[1] + start;
+#if defined(__SSE2__)
+         for (; i + 8 <= n; i += 8)
+         {
+            __m128i lv = _mm_packs_epi32(
+               _mm_loadu_si128((const __m128i*)(l + i)),
+               _mm_loadu_si128((const __m128i*)(l + i + 4))
+            );
+            __m128i rv = _mm_packs_epi32(
+               _mm_loadu_si128((const __m128i*)(r + i)),
+               _mm_loadu_si128((const __m128i*)(r + i + 4))
+            );
+            _mm_storeu_si128((__m128i*)(out + 2*i), _mm_unpacklo_epi16(lv, rv));
+            _mm_storeu_si128((__m128i*)(out + 2*i + 8), _mm_unpackhi_epi16(lv, rv));
+         }
+#elif defined(__ARM_NEON)
+         for (; i + 4 <= n; i += 4)
+         {
+            int16x4x2_t v;
+            v.val[0] = vmovn_s32(vld1q_s32(l + i));
+            v.val[1] = vmovn_s32(vld1q_s32(r + i));
+            vst2_s16(out + 2*i, v);
+         }
+#endif
+         for (; i < n; ++i)
+         {
+            out[2*i] = l[i];
+            out[2*i+1] = r[i];
+         }
+      }
+      break;
+   default:
+      for (int c = 0; c < channels; ++c)
+      {
+         auto in = buffer[c] + start;
+         auto p = out + c;
+         for (i = 0; i < n; ++i, p += channels)
+            *p = in[i];
+      }
+   }
+}
+
+void
+Interleave24(
+   const FLAC__int32 * const buffer[],
+   int channels,
+   int start,
+   int n,
+   void *dst
+)
+{
+   auto out = (unsigned char*)dst;
+
+   switch (channels)
+   {
+   case 1:
+      {
+         auto m = buffer[0] + start;
+         for (int i = 0; i < n; ++i, out += 3)
+            Store24(out, m[i]);
+      }
+      break;
+   case 2:
+      {
+         auto l = buffer[0] + start;
+         auto r = buffer[1] + start;
+         for (int i = 0; i < n; ++i, out += 6)
+         {
+            Store24(out, l[i]);
+            Store24(out + 3, r[i]);
+         }
+      }
+      break;
+   default:
+      for (int c = 0; c < channels; ++c)
+      {
+         auto in = buffer[c] + start;
+         auto p = out + c * 3;
+         for (int i = 0; i < n; ++i, p += channels * 3)
+            Store24(p, in[i]);
+      }
+   }
+}
+
+// Other bit depths: scale to 16 bits if smaller, 24 if larger.
+//
+void
+InterleaveScaled(
+   const FLAC__int32 * const buffer[],
+   int channels,
+   int bps,
+   int start,
+   int n,
+   void *dst
+)
+{
+   float factor = (bps < 16) ? 32767.0f : 8388607.0f;
+   float conversion = 1.0f / (1LL << (bps-1)) * factor;
+
+   for (int c = 0; c < channels; ++c)
+   {
+      auto in = buffer[c] + start;
+
+      if (bps < 16)
+      {
+         auto p = (int16_t*)dst + c;
+         for (int i = 0; i < n; ++i, p += channels)
+            *p = in[i] * conversion;
+      }
+      else
+      {
+         auto p = (unsigned char*)dst + c * 3;
+         for (int i = 0; i < n; ++i, p += channels * 3)
+            Store24(p, in[i] * conversion);
+      }
+   }
+}
+
+void
+Interleave(
+   const FLAC__int32 * const buffer[],
+   int channels,
+   int bps,
+   int start,
+   int n,
+   void *dst
+)
+{
+   switch (bps)
+   {
+   case 16:
+      Interleave16(buffer, channels, start, n, dst);
+      break;
+   case 24:
+      Interleave24(buffer, channels, start, n, dst);
+      break;
+   default:
+      InterleaveScaled(buffer, channels, bps, start, n, dst);
+   }
+}
+
+void
+DeleteDecoder(FLAC__StreamDecoder *p)
+{
+   FLAC__stream_decoder_delete(p);
+}
+
+// FLAC__stream_decoder_new() allocates a good deal of state, which can be
+// reused once FLAC__stream_decoder_finish() puts it back to how new()
+// left it.
+//
+DecoderPool<FLAC__StreamDecoder, DeleteDecoder> &
+GetDecoderPool(void)
+{
+   static auto pool = new DecoderPool<FLAC__StreamDecoder, DeleteDecoder>();
+   return *pool;
+}
+
 class FlacSource : public Source
 {
    Pointer<Stream> stream;
@@ -30,14 +270,35 @@ class FlacSource : public Source
    bool eof;
    void *currentBuffer;
    int currentLen;
-   std::vector<unsigned char> pendingSamples;
+   CarryOver pendingSamples;
    int channels;
    int sampleRate;
    int bitsPerSample;
+   int maxBlockSize;
    uint64_t currentPos;
    bool isOgg;
    char description[128];
    MetadataReceiver recv;
+   bool haveRecv;
+
+   // Known frame positions: the file's own SEEKTABLE, plus an index of
+   // frames we have decoded, which the caller may have kept from an
+   // earlier open.  Only used for native FLAC; libFLAC can't report
+   // stream offsets inside ogg.
+   //
+   struct SeekPoint
+   {
+      uint64_t Sample;
+      uint64_t FileOffset;
+   };
+   std::vector<SeekPoint> seekPoints;
+   std::shared_ptr<FrameIndexSeekTable> frameIndex;
+   uint64_t firstFrameOffset;
+
+   // When seeking by hand, frames before this sample are thrown away.
+   //
+   bool skipping;
+   uint64_t skipTo;
 public:
 
    FlacSource(Stream *stream_, bool ogg) :
@@ -46,17 +307,28 @@ public:
       eof(false),
       currentBuffer(nullptr),
       currentLen(0),
+      channels(0),
+      sampleRate(0),
+      bitsPerSample(0),
+      maxBlockSize(0),
       currentPos(0),
-      isOgg(ogg)
+      isOgg(ogg),
+      haveRecv(false),
+      firstFrameOffset(0),
+      skipping(false),
+      skipTo(0)
    {
-      file = FLAC__stream_decoder_new();
+      file = GetDecoderPool().Get();
+      if (!file)
+         file = FLAC__stream_decoder_new();
       if (!file)
          throw std::bad_alloc();
    }
 
    ~FlacSource()
    {
-      FLAC__stream_decoder_delete(file);
+      FLAC__stream_decoder_finish(file);
+      GetDecoderPool().Put(file);
    }
 
    const char *Describe(void)
@@ -72,21 +344,48 @@ public:
    }
 
    void
-   Initialize(MetadataReceiver *recv, error *err)
+   Initialize(CodecArgs &params, error *err)
    {
       FLAC__StreamDecoderInitStatus status;
+      auto recv = params.Metadata;
 
       if (recv)
       {
          try
          {
             this->recv = *recv;
-            recv = &this->recv;
+            haveRecv = true;
          }
          catch (const std::bad_alloc&)
          {
             ERROR_SET(err, nomem);
          }
+
+         FLAC__stream_decoder_set_metadata_respond(
+            file,
+            FLAC__METADATA_TYPE_VORBIS_COMMENT
+         );
+      }
+
+      if (!isOgg)
+      {
+         FLAC__stream_decoder_set_metadata_respond(
+            file,
+            FLAC__METADATA_TYPE_SEEKTABLE
+         );
+
+         frameIndex = params.FrameIndex;
+         if (!frameIndex)
+         {
+            try
+            {
+               frameIndex = std::make_shared<FrameIndexSeekTable>();
+            }
+            catch (const std::bad_alloc&)
+            {
+               ERROR_SET(err, nomem);
+            }
+         }
       }
 
       status =
@@ -99,13 +398,49 @@ public:
            LengthCallback,
            EofCallback,
            WriteCallback,
-           recv ? MetadataCallback : nullptr,
+           MetadataCallback,
            ErrorCallback,
            this
         );
       if (status)
          ERROR_SET(err, unknown, FLAC__StreamDecoderInitStatusString[status]);
 
+      if (!FLAC__stream_decoder_process_until_end_of_metadata(file))
+         ERROR_SET(err, unknown, "decoder error");
+
+      // SEEKTABLE offsets count from here.
+      //
+      if (!isOgg)
+      {
+         if (!FLAC__stream_decoder_get_decode_position(file, &firstFrameOffset))
+         {
+            seekPoints.clear();
+            frameIndex = nullptr;
+         }
+         else
+         {
+            if (frameIndex)
+            {
+               frameIndex->Bind(stream.Get(), firstFrameOffset, err);
+               ERROR_CHECK(err);
+            }
+
+            for (auto &p : seekPoints)
+               p.FileOffset += firstFrameOffset;
+            if (!seekPoints.size() || seekPoints[0].Sample)
+            {
+               try
+               {
+                  seekPoints.insert(seekPoints.begin(), {0, firstFrameOffset});
+               }
+               catch (const std::bad_alloc&)
+               {
+                  ERROR_SET(err, nomem);
+               }
+            }
+         }
+      }
+
       while (!FLAC__stream_decoder_get_sample_rate(file))
       {
          if (!FLAC__stream_decoder_process_single(file))
@@ -131,7 +466,9 @@ public:
 
       res->SampleRate = FLAC__stream_decoder_get_sample_rate(file);
       res->Channels = FLAC__stream_decoder_get_channels(file);
-      res->SamplesPerFrame = 0;
+      // A buffer of this size always holds a whole frame, see Read().
+      //
+      res->SamplesPerFrame = maxBlockSize;
 
       ApplyChannelLayout(*res, GetCommonWavChannelLayout, err);
       ERROR_CHECK(err);
@@ -146,16 +483,15 @@ public:
       if (!len)
          goto exit;
 
-      if (pendingSamples.size())
+      // Return leftovers by themselves, so that the next call starts
+      // on a frame boundary with the whole buffer free.  That way a
+      // caller who reads SamplesPerFrame at a time gets every frame
+      // interleaved directly into its buffer.
+      //
+      if (!pendingSamples.Empty())
       {
-         int n = MIN(pendingSamples.size(), len);
-         memcpy(buf, pendingSamples.data(), n);
-         buf = (char*)buf + n;
-         len -= n;
-         r += n;
-         pendingSamples.erase(pendingSamples.begin(), pendingSamples.begin() + n);
-         if (!len)
-            goto exit;
+         r += pendingSamples.Drain(buf, len);
+         goto exit;
       }
 
       currentBuffer = buf;
@@ -169,7 +505,7 @@ public:
    exit:
       currentBuffer = nullptr;
       currentLen = 0;
-      currentPos += r / (channels * bitsPerSample / 8);
+      currentPos += r / (channels * GetOutputSampleSize(bitsPerSample));
       return r;
    }
 
@@ -180,10 +516,13 @@ public:
       error *err
    )
    {
-      const auto channels = frame->header.channels;
-      const auto bps = frame->header.bits_per_sample;
-      float conversion = 1.0f;
-      float factor;
+      const int channels = frame->header.channels;
+      const int bps = frame->header.bits_per_sample;
+      const int blocksize = frame->header.blocksize;
+      const int sampleSize = channels * GetOutputSampleSize(bps);
+      const uint64_t firstSample = GetFrameSample(frame);
+      int start = 0;
+      int n = 0;
 
       if (channels != this->channels ||
           bps != bitsPerSample ||
@@ -196,87 +535,166 @@ public:
          this->sampleRate = frame->header.sample_rate;
       }
 
-      if (bps < 16)
-         factor = 32767.0f;
-      else if (bps != 24)
-         factor = 8388607.0f;
+      OnFrameLocated(firstSample + blocksize, err);
+      ERROR_CHECK(err);
 
-      if (bps != 16 && bps != 24)
-         conversion = 1.0f / (1LL << (bps-1)) * factor;
+      if (skipping)
+      {
+         if (firstSample + blocksize <= skipTo)
+            goto exit;
+         if (skipTo > firstSample)
+            start = skipTo - firstSample;
+         skipping = false;
+      }
 
-      try
+      // As much as fits goes straight to the caller's buffer.
+      //
+      if (!MetadataChanged)
       {
-         for (int i = 0; i < frame->header.blocksize; i++)
-         {
-            for (int channel = 0; channel < channels; ++channel)
-            {
-               auto sample = buffer[channel][i];
-               void *res;
-               const void *src;
-               size_t len = bps/8;
-               union
-               {
-                  int16_t d16;
-                  int32_t d32;
-               } dummy;
-               static const int le = 1;
+         n = MIN(blocksize - start, currentLen / sampleSize);
+         Interleave(buffer, channels, bps, start, n, currentBuffer);
+         currentBuffer = (char*)currentBuffer + n * sampleSize;
+         currentLen -= n * sampleSize;
+         start += n;
+      }
 
-               if (bps == 16)
-               {
-                  dummy.d16 = sample;
-                  src = &dummy.d16;
-               }
-               else if (bps == 24)
-               {
-                  src = (char*)&sample + !*(char*)&le;
-               }
-               else if (bps < 16)
-               {
-                  dummy.d16 = sample * conversion;
-                  src = &dummy.d16;
-                  len = 2;
-               }
-               else
-               {
-                  dummy.d32 = sample * conversion;
-                  src = (char*)&dummy.d32 + !*(char*)&le;
-                  len = 3;
-               }
+      // The rest waits for the next Read().
+      //
+      if (start < blocksize)
+      {
+         void *p = pendingSamples.Extend((blocksize - start) * sampleSize, err);
+         ERROR_CHECK(err);
+         Interleave(buffer, channels, bps, start, blocksize - start, p);
+      }
+   exit:;
+   }
 
-               if (!MetadataChanged && currentLen >= len)
-               {
-                  res = currentBuffer;
-                  currentBuffer = (char*)currentBuffer + len;
-                  currentLen -= len;
-               }
-               else
-               {
-                  for (int i=len; i--;)
-                     pendingSamples.push_back(0);
+   // Called from the write callback: the decoder is now at the start of
+   // the frame that begins with @nextSample.
+   //
+   void
+   OnFrameLocated(uint64_t nextSample, error *err)
+   {
+      FLAC__uint64 off = 0;
 
-                  res = pendingSamples.data() + pendingSamples.size() - len;
-               }
+      if (!frameIndex || !sampleRate)
+         goto exit;
 
-               memcpy(res, src, len);
-            }
+      if (!FLAC__stream_decoder_get_decode_position(file, &off))
+         goto exit;
+
+      frameIndex->OnFrame(nextSample * 10000000LL / sampleRate, off, err);
+      ERROR_CHECK(err);
+   exit:;
+   }
+
+   // Find the closest known frame at or before @samplePos.
+   //
+   bool
+   FindSeekPoint(uint64_t samplePos, SeekPoint &res, error *err)
+   {
+      bool found = false;
+      uint64_t t = 0, off = 0;
+
+      auto p = std::upper_bound(
+         seekPoints.begin(),
+         seekPoints.end(),
+         samplePos,
+         [] (uint64_t s, const SeekPoint &p) -> bool { return s < p.Sample; }
+      );
+      if (p != seekPoints.begin())
+      {
+         res = *--p;
+         found = true;
+      }
+
+      if (frameIndex &&
+          frameIndex->Lookup(samplePos * 10000000LL / sampleRate, t, off, err))
+      {
+         // Index times are rounded down from sample positions, so round
+         // back up to get the frame's real first sample.
+         //
+         uint64_t s = (t * sampleRate + 10000000LL - 1) / 10000000LL;
+         if (s <= samplePos && (!found || s > res.Sample))
+         {
+            res.Sample = s;
+            res.FileOffset = off;
+            found = true;
          }
       }
-      catch (const std::bad_alloc&)
+      ERROR_CHECK(err);
+   exit:
+      return found && !ERROR_FAILED(err);
+   }
+
+   // Jump the stream to a frame boundary we already know about and
+   // decode forward, instead of letting libFLAC bisect the file.
+   //
+   bool
+   TrySeekToKnownFrame(uint64_t samplePos, error *err)
+   {
+      SeekPoint point;
+      bool r = false;
+
+      if (isOgg || !FindSeekPoint(samplePos, point, err))
+         goto exit;
+
+      // If we're already between the seek point and the target,
+      // decoding forward is cheaper than re-reading.
+      //
+      if (!(point.Sample <= currentPos && currentPos <= samplePos &&
+            pendingSamples.Empty()))
       {
-         ERROR_SET(err, nomem);
+         stream->Seek(point.FileOffset, SEEK_SET, err);
+         ERROR_CHECK(err);
+
+         eof = false;
+         if (!FLAC__stream_decoder_flush(file))
+            goto exit;
       }
-   exit:;
+
+      pendingSamples.Clear();
+      skipping = true;
+      skipTo = samplePos;
+
+      while (skipping &&
+             FLAC__stream_decoder_get_state(file) != FLAC__STREAM_DECODER_END_OF_STREAM)
+      {
+         if (!FLAC__stream_decoder_process_single(file))
+         {
+            skipping = false;
+            goto exit;
+         }
+      }
+
+      skipping = false;
+      r = true;
+   exit:
+      return r;
    }
 
    void Seek(uint64_t pos, error *err)
    {
       auto samplePos = pos * FLAC__stream_decoder_get_sample_rate(file)
                           / 10000000LL;
+
+      if (TrySeekToKnownFrame(samplePos, err))
+         goto done;
+      ERROR_CHECK(err);
+
+      // libFLAC hands us the partial frame at the target from inside
+      // the seek, so clear out anything older first.
+      //
+      pendingSamples.Clear();
+
+      if (FLAC__stream_decoder_get_state(file) == FLAC__STREAM_DECODER_SEEK_ERROR)
+         FLAC__stream_decoder_flush(file);
+
       if (!FLAC__stream_decoder_seek_absolute(file, samplePos))
       {
          ERROR_SET(err, unknown, "Failed to seek");
       }
-      pendingSamples.resize(0);
+   done:
       currentPos = samplePos;
    exit:;
    }
@@ -307,6 +725,14 @@ public:
 
 private:
 
+   static uint64_t
+   GetFrameSample(const FLAC__Frame *frame)
+   {
+      if (frame->header.number_type == FLAC__FRAME_NUMBER_TYPE_SAMPLE_NUMBER)
+         return frame->header.number.sample_number;
+      return (uint64_t)frame->header.number.frame_number * frame->header.blocksize;
+   }
+
    static FLAC__StreamDecoderWriteStatus
    WriteCallback(
       const FLAC__StreamDecoder *decoder,
@@ -430,8 +856,34 @@ private:
       const FLAC__StreamDecoder *decoder, const FLAC__StreamMetadata *metadata, void *client_data
    )
    {
-      auto recv = &((FlacSource*)client_data)->recv;
-      if (metadata->type == FLAC__METADATA_TYPE_VORBIS_COMMENT)
+      auto This = (FlacSource*)client_data;
+      auto recv = &This->recv;
+      if (metadata->type == FLAC__METADATA_TYPE_STREAMINFO)
+      {
+         This->maxBlockSize = metadata->data.stream_info.max_blocksize;
+      }
+      else if (metadata->type == FLAC__METADATA_TYPE_SEEKTABLE)
+      {
+         auto &table = metadata->data.seek_table;
+
+         try
+         {
+            This->seekPoints.clear();
+            for (unsigned i=0; i<table.num_points; ++i)
+            {
+               auto &point = table.points[i];
+               if (point.sample_number == FLAC__STREAM_METADATA_SEEKPOINT_PLACEHOLDER)
+                  continue;
+               This->seekPoints.push_back({point.sample_number, point.stream_offset});
+            }
+         }
+         catch (const std::bad_alloc&)
+         {
+            This->seekPoints.clear();
+         }
+      }
+      else if (metadata->type == FLAC__METADATA_TYPE_VORBIS_COMMENT &&
+               This->haveRecv)
       {
          error err;
 
@@ -470,6 +922,7 @@ private:
 struct FlacCodec : public Codec
 {
    int GetBytesRequiredForDetection() { return 4; }
+   FileType GetFileType() { return FileTypeFlac; }
 
    void TryOpen(
       common::Stream *file,
@@ -505,7 +958,7 @@ void audio::CreateFlacSource(
    {
       ERROR_SET(err, nomem);
    }
-   r->Initialize(params.Metadata, err);
+   r->Initialize(params, err);
 exit:
    if (ERROR_FAILED(err)) r = nullptr;
    *obj = r.Detach();;
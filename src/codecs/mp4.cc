@@ -13,6 +13,9 @@
 #include <common/logger.h>
 #include <common/c++/new.h>
 
+#include "packedtable.h"
+
+#include <algorithm>
 #include <vector>
 #include <functional>
 #include <string>
@@ -28,6 +31,7 @@ struct ParsedBoxHeader
 {
    uint64_t Size;
    char Type[4];
+   int HeaderLength;
 };
 
 uint16_t
@@ -67,6 +71,41 @@ Read(
 exit:;
 }
 
+// Reads @n fixed-size table entries, a bufferful at a time, and hands
+// each one to @fn.
+//
+template <class Fn>
+void
+ReadTable(
+   Stream *file,
+   uint32_t n,
+   size_t entrySize,
+   uint64_t *limit,
+   Fn fn,
+   error *err
+)
+{
+   unsigned char buf[4096];
+   size_t perRead = sizeof(buf) / entrySize;
+
+   while (n)
+   {
+      size_t count = MIN(n, perRead);
+
+      Read(file, buf, count * entrySize, limit, err);
+      ERROR_CHECK(err);
+
+      for (size_t i=0; i<count; ++i)
+      {
+         fn(buf + i * entrySize, err);
+         ERROR_CHECK(err);
+      }
+
+      n -= count;
+   }
+exit:;
+}
+
 void
 ParseBoxHeader(
    Stream *file,
@@ -87,8 +126,12 @@ ParseBoxHeader(
    Read(file, header.Type, sizeof(header.Type), limit, err);
    ERROR_CHECK(err);
 
+   header.HeaderLength = 8;
+
    if (size32 == 1)
    {
+      header.HeaderLength = 16;
+
       unsigned char size64[8];
       Read(file, size64, sizeof(size64), limit, err);
       ERROR_CHECK(err);
@@ -161,6 +204,13 @@ struct SttsEntry
 {
    uint32_t SampleCount;
    uint32_t DurationPerSample;
+
+   // Filled in by Track::IndexDurations().  Duration is per sample, and
+   // it and StartTime are in 100ns units.
+   //
+   uint64_t FirstSample;
+   uint64_t StartTime;
+   uint64_t Duration;
 };
 
 template<class Tkey, class Tvalue, class CMP>
@@ -210,11 +260,10 @@ struct Track
    Handler Handler;
    uint32_t DefaultSampleSize;
    uint32_t NumberOfSamples;
-   std::vector<uint32_t> SampleSizes;
-   std::vector<uint32_t> ChunkTable;
+   PackedTable SampleSizes;
+   PackedTable ChunkTable;
    std::vector<StscEntry> SamplesInChunk;
    std::vector<SttsEntry> DurationPerSample;
-   bool ChunkTableIs64Bit;
 
    enum
    {
@@ -229,6 +278,11 @@ struct Track
    uint64_t CodecBoxOffset;
    uint64_t CodecBoxLength;
 
+   // Sample defaults from the trex box, for movie fragments.
+   //
+   uint32_t FragmentDefaultDuration;
+   uint32_t FragmentDefaultSize;
+
    const StscEntry *
    GetSamplesInChunk(int chunkNo)
    {
@@ -259,7 +313,7 @@ struct Track
    int
    GetNumChunks()
    {
-      return ChunkTable.size() / (ChunkTableIs64Bit ? 2 : 1);
+      return ChunkTable.Size();
    }
 
    void
@@ -267,21 +321,10 @@ struct Track
    {
       if (idx < 0)
          ERROR_SET(err, unknown, "Chunk index cannot be negative");
-      if (ChunkTableIs64Bit)
-      {
-         uint64_t *values = (uint64_t*)ChunkTable.data();
-         int n = ChunkTable.size() / 2;
-         if (idx >= n)
-            ERROR_SET(err, unknown, "Invalid chunk index");
-         *value = values[idx];
-      }
-      else
-      {
-         if (idx >= ChunkTable.size())
-            ERROR_SET(err, unknown, "Invalid chunk index");
+      if (idx >= ChunkTable.Size())
+         ERROR_SET(err, unknown, "Invalid chunk index");
 
-         *value = ChunkTable[idx];
-      } 
+      *value = ChunkTable.Get(idx);
    exit:;
    }
 
@@ -291,15 +334,73 @@ struct Track
       if (idx < 0 || idx >= NumberOfSamples)
          ERROR_SET(err, unknown, "Invalid sample index");
 
-      return DefaultSampleSize ? DefaultSampleSize : SampleSizes[idx]; 
+      if (DefaultSampleSize)
+         return DefaultSampleSize;
+
+      if (idx >= SampleSizes.Size())
+         ERROR_SET(err, unknown, "Invalid sample index");
+
+      return SampleSizes.Get(idx);
    exit:
       return 0;
    }
 
+   // Number the stts runs by sample and time, so that lookups can
+   // binary search them.  Runs past the last sample are dropped.
+   //
+   void
+   IndexDurations(error *err)
+   {
+      uint64_t sample = 0, time = 0;
+      size_t i = 0;
+
+      if (!TimeScale)
+         ERROR_SET(err, unknown, "Unknown time scale");
+
+      for (i = 0; i < DurationPerSample.size() && sample < NumberOfSamples; ++i)
+      {
+         auto &stts = DurationPerSample[i];
+
+         stts.SampleCount = MIN(stts.SampleCount, NumberOfSamples - sample);
+         stts.FirstSample = sample;
+         stts.StartTime = time;
+         stts.Duration = stts.DurationPerSample * (10000000.0 / TimeScale);
+
+         sample += stts.SampleCount;
+         time += stts.SampleCount * stts.Duration;
+      }
+
+      DurationPerSample.resize(i);
+   exit:;
+   }
+
+   // Returns the stts run containing sample @idx, or nullptr.
+   //
+   const SttsEntry *
+   GetDurationRun(uint64_t idx)
+   {
+      auto p = std::upper_bound(
+         DurationPerSample.begin(),
+         DurationPerSample.end(),
+         idx,
+         [] (uint64_t idx, const SttsEntry &stts) -> bool
+         {
+            return idx < stts.FirstSample;
+         }
+      );
+      if (p == DurationPerSample.begin())
+         return nullptr;
+      --p;
+      if (idx - p->FirstSample >= p->SampleCount)
+         return nullptr;
+      return &*p;
+   }
+
    uint64_t
    GetSampleDuration(int idx, error *err)
    {
       uint64_t r = 0;
+      const SttsEntry *stts = nullptr;
 
       if (idx < 0 || idx >= NumberOfSamples)
          ERROR_SET(err, unknown, "Invalid sample index");
@@ -307,22 +408,151 @@ struct Track
       if (!TimeScale)
          ERROR_SET(err, unknown, "Unknown time scale");
 
-      for (auto &stts : DurationPerSample)
+      stts = GetDurationRun(idx);
+      if (!stts)
+         ERROR_SET(err, unknown, "Did not find duration in stts");
+
+      r = stts->Duration;
+   exit:
+      return r;
+   }
+
+   // Where sample @idx starts, in 100ns units.
+   //
+   uint64_t
+   GetSampleTime(uint64_t idx)
+   {
+      auto stts = GetDurationRun(idx);
+      if (!stts)
+         return GetIndexedDuration();
+      return stts->StartTime + (idx - stts->FirstSample) * stts->Duration;
+   }
+
+   // Total time covered by stts, in 100ns units.
+   //
+   uint64_t
+   GetIndexedDuration(void)
+   {
+      if (!DurationPerSample.size())
+         return 0;
+
+      auto &stts = DurationPerSample.back();
+      return stts.StartTime + stts.SampleCount * stts.Duration;
+   }
+
+   // For movie fragments: add a chunk of @samples samples at @offset.  The
+   // samples themselves follow with AppendSample().
+   //
+   void
+   AppendChunk(uint64_t offset, uint32_t samples, error *err)
+   {
+      ChunkTable.Append(offset, err);
+      ERROR_CHECK(err);
+
+      if (!SamplesInChunk.size() || SamplesInChunk.back().SamplesPerChunk != samples)
       {
-         if (idx < stts.SampleCount)
+         StscEntry entry;
+
+         entry.FirstChunk = ChunkTable.Size();
+         entry.SamplesPerChunk = samples;
+         entry.DescriptionIndex = 1;
+
+         try
          {
-            r = stts.DurationPerSample * (10000000.0 / TimeScale);
-            idx = 0;
-            break;
+            SamplesInChunk.push_back(entry);
+         }
+         catch (const std::bad_alloc&)
+         {
+            ERROR_SET(err, nomem);
          }
-         idx -= stts.SampleCount;
       }
+   exit:;
+   }
 
-      if (idx)
-         ERROR_SET(err, unknown, "Did not find duration in stts");
+   void
+   AppendSample(uint32_t size, uint32_t duration, error *err)
+   {
+      // Any samples in moov had one size for all, but fragments can vary.
+      //
+      if (DefaultSampleSize)
+      {
+         while (SampleSizes.Size() < NumberOfSamples)
+         {
+            SampleSizes.Append(DefaultSampleSize, err);
+            ERROR_CHECK(err);
+         }
+         DefaultSampleSize = 0;
+      }
 
-   exit:
-      return r;
+      SampleSizes.Append(size, err);
+      ERROR_CHECK(err);
+
+      if (DurationPerSample.size() &&
+          DurationPerSample.back().DurationPerSample == duration)
+      {
+         ++DurationPerSample.back().SampleCount;
+      }
+      else
+      {
+         SttsEntry stts;
+
+         stts.SampleCount = 1;
+         stts.DurationPerSample = duration;
+         stts.FirstSample = NumberOfSamples;
+         stts.StartTime = GetIndexedDuration();
+         stts.Duration = TimeScale ? duration * (10000000.0 / TimeScale) : 0;
+
+         try
+         {
+            DurationPerSample.push_back(stts);
+         }
+         catch (const std::bad_alloc&)
+         {
+            ERROR_SET(err, nomem);
+         }
+      }
+
+      ++NumberOfSamples;
+   exit:;
+   }
+
+   // Finds the last sample that starts at or before @desiredTime, and
+   // that time.  A sample index of NumberOfSamples means the end.
+   //
+   void
+   FindSampleByTime(uint64_t desiredTime, uint64_t &idx, uint64_t &time, error *err)
+   {
+      auto p = std::partition_point(
+         DurationPerSample.begin(),
+         DurationPerSample.end(),
+         [desiredTime] (const SttsEntry &stts) -> bool
+         {
+            return stts.StartTime < desiredTime &&
+                   stts.StartTime + stts.SampleCount * stts.Duration <= desiredTime;
+         }
+      );
+
+      if (p == DurationPerSample.end())
+      {
+         time = GetIndexedDuration();
+         idx = DurationPerSample.size() ?
+            DurationPerSample.back().FirstSample + DurationPerSample.back().SampleCount :
+            0;
+         if (desiredTime > time)
+            ERROR_SET(err, unknown, "Invalid sample index");
+      }
+      else if (p->StartTime >= desiredTime)
+      {
+         idx = p->FirstSample;
+         time = p->StartTime;
+      }
+      else
+      {
+         uint64_t n = (desiredTime - p->StartTime) / p->Duration;
+         idx = p->FirstSample + n;
+         time = p->StartTime + n * p->Duration;
+      }
+   exit:;
    }
 
    Track() :
@@ -332,14 +562,22 @@ struct Track
       MediaDuration(0),
       Language(0),
       DefaultSampleSize(0),
-      ChunkTableIs64Bit(false),
       Codec(Unrecognized),
       CodecBoxOffset(0),
-      CodecBoxLength(0)
+      CodecBoxLength(0),
+      FragmentDefaultDuration(0),
+      FragmentDefaultSize(0)
    {
    }
 };
 
+struct TrackExtends
+{
+   uint32_t TrackId;
+   uint32_t DefaultDuration;
+   uint32_t DefaultSize;
+};
+
 struct ParsedMoovBox
 {
    uint32_t TimeScale;
@@ -348,11 +586,18 @@ struct ParsedMoovBox
    MetadataReceiver *Metadata;
    bool MetadataOnly;
 
+   // From mvex, for fragmented files.  FragmentDuration is in TimeScale
+   // units.
+   //
+   uint64_t FragmentDuration;
+   std::vector<TrackExtends> Extends;
+
    ParsedMoovBox() :
       TimeScale(0),
       Duration(0),
       Metadata(nullptr),
-      MetadataOnly(false)
+      MetadataOnly(false),
+      FragmentDuration(0)
    {
    }
 };
@@ -482,12 +727,17 @@ ParseStsz(
    if (track.DefaultSampleSize)
       goto exit;
 
-   while (n--)
-   {
-      Read(stream, readBuf, 4, &length, err);
-      ERROR_CHECK(err);
-      track.SampleSizes.push_back(read32(readBuf));
-   }
+   ReadTable(
+      stream, n, 4, &length,
+      [&track] (unsigned char *p, error *err) -> void
+      {
+         track.SampleSizes.Append(read32(p), err);
+      },
+      err
+   );
+   ERROR_CHECK(err);
+
+   track.SampleSizes.Shrink();
 
 exit:;
 }
@@ -503,20 +753,25 @@ ParseStco(
    unsigned char readBuf[8];
    uint32_t n = 0;
 
-   if (track.ChunkTable.size())
+   if (track.ChunkTable.Size())
       ERROR_SET(err, unknown, "Chunk table specified twice?");
 
    Read(stream, readBuf, sizeof(readBuf), &length, err);
    ERROR_CHECK(err);
       
    n = read32(readBuf + 4);
-   
-   while (n--)
-   {
-      Read(stream, readBuf, 4, &length, err);
-      ERROR_CHECK(err);
-      track.ChunkTable.push_back(read32(readBuf));
-   }
+
+   ReadTable(
+      stream, n, 4, &length,
+      [&track] (unsigned char *p, error *err) -> void
+      {
+         track.ChunkTable.Append(read32(p), err);
+      },
+      err
+   );
+   ERROR_CHECK(err);
+
+   track.ChunkTable.Shrink();
 
 exit:;
 }
@@ -532,34 +787,29 @@ ParseCo64(
    unsigned char readBuf[8];
    uint32_t n = 0;
 
-   if (track.ChunkTable.size())
+   if (track.ChunkTable.Size())
       ERROR_SET(err, unknown, "Chunk table specified twice?");
 
-   track.ChunkTableIs64Bit = true;
-
    Read(stream, readBuf, sizeof(readBuf), &length, err);
    ERROR_CHECK(err);
 
    n = read32(readBuf + 4);
 
-   while (n--)
-   {
-      union
+   ReadTable(
+      stream, n, 8, &length,
+      [&track] (unsigned char *p, error *err) -> void
       {
-         uint64_t i64;
-         uint32_t i32[2];
-      } d;
-
-      Read(stream, readBuf, 8, &length, err);
-      ERROR_CHECK(err);
+         uint64_t offset = read32(p);
+         offset <<= 32;
+         offset |= read32(p + 4);
 
-      d.i64 = read32(readBuf);
-      d.i64 <<= 32;
-      d.i64 |= read32(readBuf+4);
+         track.ChunkTable.Append(offset, err);
+      },
+      err
+   );
+   ERROR_CHECK(err);
 
-      track.ChunkTable.push_back(d.i32[0]);
-      track.ChunkTable.push_back(d.i32[1]);
-   }
+   track.ChunkTable.Shrink();
 
 exit:;
 }
@@ -758,24 +1008,26 @@ ParseStsc(
    error *err
 )
 {
-   unsigned char readBuffer[12];
+   unsigned char readBuffer[8];
    uint32_t n = 0;
    Read(stream, readBuffer, 8, &length, err);
    ERROR_CHECK(err);
    n = read32(readBuffer + 4);
-   while (n--)
-   {
-      Read(stream, readBuffer, sizeof(readBuffer), &length, err);
-      ERROR_CHECK(err);
-
-      StscEntry entry; 
+   ReadTable(
+      stream, n, 12, &length,
+      [&track] (unsigned char *p, error *err) -> void
+      {
+         StscEntry entry;
 
-      entry.FirstChunk = read32(readBuffer);
-      entry.SamplesPerChunk = read32(readBuffer + 4);
-      entry.DescriptionIndex = read32(readBuffer + 8);
+         entry.FirstChunk = read32(p);
+         entry.SamplesPerChunk = read32(p + 4);
+         entry.DescriptionIndex = read32(p + 8);
 
-      track.SamplesInChunk.push_back(entry);
-   }
+         track.SamplesInChunk.push_back(entry);
+      },
+      err
+   );
+   ERROR_CHECK(err);
 exit:;
 }
 
@@ -800,18 +1052,20 @@ ParseStts(
 
    n = read32(readBuffer + 4);
 
-   while (n--)
-   {
-      SttsEntry entry;
-
-      Read(stream, readBuffer, 8, &length, err);
-      ERROR_CHECK(err);
+   ReadTable(
+      stream, n, 8, &length,
+      [&track] (unsigned char *p, error *err) -> void
+      {
+         SttsEntry entry;
 
-      entry.SampleCount = read32(readBuffer);
-      entry.DurationPerSample = read32(readBuffer + 4);
+         entry.SampleCount = read32(p);
+         entry.DurationPerSample = read32(p + 4);
 
-      track.DurationPerSample.push_back(entry);
-   }
+         track.DurationPerSample.push_back(entry);
+      },
+      err
+   );
+   ERROR_CHECK(err);
 
 exit:;
 }
@@ -945,6 +1199,14 @@ ParseMdia(
       err
    );
    ERROR_CHECK(err);
+
+   // Both stts and the time scale from mdhd are needed for this.
+   //
+   if (track.DurationPerSample.size() && track.TimeScale)
+   {
+      track.IndexDurations(err);
+      ERROR_CHECK(err);
+   }
 exit:;
 }
 
@@ -1150,6 +1412,60 @@ ParseUdta(
    );
 }
 
+void
+ParseMvex(
+   Stream *stream,
+   uint64_t length,
+   ParsedMoovBox &moov,
+   error *err
+)
+{
+   ParseBoxes(
+      stream,
+      length,
+      [&stream, &err, &moov] (const ParsedBoxHeader &header)
+      {
+         unsigned char readBuf[24];
+         uint64_t boxLength = header.Size;
+
+         if (!memcmp(header.Type, "mehd", 4))
+         {
+            Read(stream, readBuf, 4, &boxLength, err);
+            ERROR_CHECK(err);
+            if (readBuf[0] == 1)
+            {
+               Read(stream, readBuf, 8, &boxLength, err);
+               ERROR_CHECK(err);
+               moov.FragmentDuration = read32(readBuf);
+               moov.FragmentDuration <<= 32;
+               moov.FragmentDuration |= read32(readBuf + 4);
+            }
+            else
+            {
+               Read(stream, readBuf, 4, &boxLength, err);
+               ERROR_CHECK(err);
+               moov.FragmentDuration = read32(readBuf);
+            }
+         }
+         else if (!memcmp(header.Type, "trex", 4))
+         {
+            TrackExtends trex;
+
+            Read(stream, readBuf, sizeof(readBuf), &boxLength, err);
+            ERROR_CHECK(err);
+
+            trex.TrackId = read32(readBuf + 4);
+            trex.DefaultDuration = read32(readBuf + 12);
+            trex.DefaultSize = read32(readBuf + 16);
+
+            moov.Extends.push_back(trex);
+         }
+      exit:;
+      },
+      err
+   );
+}
+
 struct Mp4ParseFinished {};
 
 void
@@ -1169,6 +1485,8 @@ ParseMoov(
             ParseMvhd(stream, header.Size, moov, err);
          else if (!memcmp(header.Type, "trak", 4) && !moov.MetadataOnly)
             ParseTrak(stream, header.Size, moov, err);
+         else if (!memcmp(header.Type, "mvex", 4) && !moov.MetadataOnly)
+            ParseMvex(stream, header.Size, moov, err);
          else if (moov.Metadata && !memcmp(header.Type, "udta", 4))
          {
             ParseUdta(stream, header.Size, moov.Metadata, err);
@@ -1178,6 +1496,22 @@ ParseMoov(
       },
       err
    );
+   ERROR_CHECK(err);
+
+   // mvex comes after the traks it refers to, or may.
+   //
+   for (auto &trex : moov.Extends)
+   {
+      for (auto &track : moov.Tracks)
+      {
+         if (track->Id == trex.TrackId)
+         {
+            track->FragmentDefaultDuration = trex.DefaultDuration;
+            track->FragmentDefaultSize = trex.DefaultSize;
+         }
+      }
+   }
+exit:;
 }
 
 struct ParsedMp4File
@@ -1185,36 +1519,427 @@ struct ParsedMp4File
    ParsedMoovBox Moov;
    uint64_t MdatStart;
    uint64_t MdatLength;
+
+   // For fragmented files, where the first moof box starts.
+   //
+   bool Fragmented;
+   uint64_t FirstFragment;
+
+   // See CodecArgs::Mapping.
+   //
+   StreamMapping Mapping;
+
+   ParsedMp4File() :
+      MdatStart(0),
+      MdatLength(0),
+      Fragmented(false),
+      FirstFragment(0)
+   {
+   }
 };
 
-void ParseMp4File(
+//
+// Movie fragments.  Each trun becomes a chunk, so once a moof has been
+// parsed the track's tables look as they would if its samples had been
+// described in moov all along.
+//
+
+struct TrackFragment
+{
+   bool Ours;
+   uint64_t BaseOffset;
+   uint64_t NextOffset;
+   uint32_t DefaultDuration;
+   uint32_t DefaultSize;
+};
+
+void
+ParseTfhd(
    Stream *stream,
-   ParsedMp4File &file,
+   uint64_t length,
+   uint64_t moofStart,
+   Track &track,
+   TrackFragment &traf,
    error *err
 )
 {
-   bool sawMoov = false, sawMdat = false;
+   unsigned char readBuf[8];
+   uint32_t flags = 0;
 
-   uint64_t len = stream->GetSize(err);
+   Read(stream, readBuf, 8, &length, err);
+   ERROR_CHECK(err);
+
+   flags = read32(readBuf) & 0xffffff;
+   traf.Ours = (read32(readBuf + 4) == track.Id);
+   if (!traf.Ours)
+      goto exit;
+
+   traf.BaseOffset = moofStart;
+   traf.DefaultDuration = track.FragmentDefaultDuration;
+   traf.DefaultSize = track.FragmentDefaultSize;
+
+   // base-data-offset-present
+   //
+   if (flags & 0x1)
+   {
+      Read(stream, readBuf, 8, &length, err);
+      ERROR_CHECK(err);
+      traf.BaseOffset = read32(readBuf);
+      traf.BaseOffset <<= 32;
+      traf.BaseOffset |= read32(readBuf + 4);
+   }
+
+   // sample-description-index-present
+   //
+   if (flags & 0x2)
+   {
+      Read(stream, readBuf, 4, &length, err);
+      ERROR_CHECK(err);
+   }
+
+   // default-sample-duration-present
+   //
+   if (flags & 0x8)
+   {
+      Read(stream, readBuf, 4, &length, err);
+      ERROR_CHECK(err);
+      traf.DefaultDuration = read32(readBuf);
+   }
+
+   // default-sample-size-present
+   //
+   if (flags & 0x10)
+   {
+      Read(stream, readBuf, 4, &length, err);
+      ERROR_CHECK(err);
+      traf.DefaultSize = read32(readBuf);
+   }
+
+   traf.NextOffset = traf.BaseOffset;
+exit:;
+}
+
+void
+ParseTrun(
+   Stream *stream,
+   uint64_t length,
+   Track &track,
+   TrackFragment &traf,
+   error *err
+)
+{
+   unsigned char readBuf[8];
+   uint32_t flags = 0;
+   uint32_t n = 0;
+   uint64_t offset = traf.NextOffset;
+   size_t entrySize = 0;
+   int durationAt = -1, sizeAt = -1;
+
+   Read(stream, readBuf, 8, &length, err);
+   ERROR_CHECK(err);
+
+   flags = read32(readBuf) & 0xffffff;
+   n = read32(readBuf + 4);
+
+   // data-offset-present
+   //
+   if (flags & 0x1)
+   {
+      Read(stream, readBuf, 4, &length, err);
+      ERROR_CHECK(err);
+      offset = traf.BaseOffset + (int32_t)read32(readBuf);
+   }
+
+   // first-sample-flags-present
+   //
+   if (flags & 0x4)
+   {
+      Read(stream, readBuf, 4, &length, err);
+      ERROR_CHECK(err);
+   }
+
+   if (flags & 0x100)
+   {
+      durationAt = entrySize;
+      entrySize += 4;
+   }
+   if (flags & 0x200)
+   {
+      sizeAt = entrySize;
+      entrySize += 4;
+   }
+   if (flags & 0x400)
+      entrySize += 4;
+   if (flags & 0x800)
+      entrySize += 4;
+
+   if (!n)
+      goto exit;
+
+   track.AppendChunk(offset, n, err);
+   ERROR_CHECK(err);
+
+   if (entrySize)
+   {
+      ReadTable(
+         stream, n, entrySize, &length,
+         [&track, &traf, &offset, durationAt, sizeAt] (unsigned char *p, error *err) -> void
+         {
+            uint32_t duration = (durationAt >= 0) ? read32(p + durationAt) : traf.DefaultDuration;
+            uint32_t size = (sizeAt >= 0) ? read32(p + sizeAt) : traf.DefaultSize;
+
+            track.AppendSample(size, duration, err);
+            offset += size;
+         },
+         err
+      );
+      ERROR_CHECK(err);
+   }
+   else
+   {
+      while (n--)
+      {
+         track.AppendSample(traf.DefaultSize, traf.DefaultDuration, err);
+         ERROR_CHECK(err);
+         offset += traf.DefaultSize;
+      }
+   }
+
+   traf.NextOffset = offset;
+exit:;
+}
+
+void
+ParseTraf(
+   Stream *stream,
+   uint64_t length,
+   uint64_t moofStart,
+   Track &track,
+   error *err
+)
+{
+   TrackFragment traf;
+
+   traf.Ours = false;
+
+   ParseBoxes(
+      stream,
+      length,
+      [&stream, &err, &track, &traf, moofStart] (const ParsedBoxHeader &header)
+      {
+         if (!memcmp(header.Type, "tfhd", 4))
+            ParseTfhd(stream, header.Size, moofStart, track, traf, err);
+         else if (traf.Ours && !memcmp(header.Type, "trun", 4))
+            ParseTrun(stream, header.Size, track, traf, err);
+      },
+      err
+   );
+}
+
+// Add the samples for @track from the moof box starting at @moofStart.
+//
+void
+ParseMoof(
+   Stream *stream,
+   uint64_t moofStart,
+   uint64_t length,
+   Track &track,
+   error *err
+)
+{
+   ParseBoxes(
+      stream,
+      length,
+      [&stream, &err, &track, moofStart] (const ParsedBoxHeader &header)
+      {
+         if (!memcmp(header.Type, "traf", 4))
+            ParseTraf(stream, header.Size, moofStart, track, err);
+      },
+      err
+   );
+}
+
+// moov boxes up to this size are read in one go and parsed from memory.
+//
+const uint64_t MoovReadLimit = 64 * 1024 * 1024;
+
+//
+// A copy of a range of the file, for parsing a box without going back to
+// the file for every field and table entry.  Positions are those of the
+// file, so offsets recorded while parsing (eg. Track::CodecBoxOffset)
+// can be used on the file itself.
+//
+// If the file is mapped, this is a view of the mapping, and not a copy.
+//
+class Mp4MemoryStream : public Stream
+{
+   Pointer<Stream> file;
+   std::vector<unsigned char> buffer;
+   const unsigned char *data;
+   size_t size;
+   uint64_t base;
+   uint64_t pos;
+
+public:
+
+   Mp4MemoryStream(Stream *file_) : file(file_), data(nullptr), size(0), base(0), pos(0) {}
+
+   // Take @len bytes from the file's current position.
+   //
+   void
+   Initialize(uint64_t len, const StreamMapping &mapping, error *err)
+   {
+      size_t r = 0;
+
+      base = pos = file->GetPosition(err);
+      ERROR_CHECK(err);
+
+      if (mapping.Data && base <= mapping.Size && len <= mapping.Size - base)
+      {
+         data = (const unsigned char*)mapping.Data + base;
+         size = len;
+         goto exit;
+      }
+
+      try
+      {
+         buffer.resize(len);
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+
+      while (r < len)
+      {
+         size_t n = file->Read(buffer.data() + r, len - r, err);
+         ERROR_CHECK(err);
+         if (!n)
+            ERROR_SET(err, unknown, "Short read");
+         r += n;
+      }
+
+      data = buffer.data();
+      size = buffer.size();
+   exit:;
+   }
+
+   uint64_t GetSize(error *err)
+   {
+      return base + size;
+   }
+
+   uint64_t GetPosition(error *err)
+   {
+      return pos;
+   }
+
+   void Seek(int64_t pos, int whence, error *err)
+   {
+      switch (whence)
+      {
+      case SEEK_SET:
+         break;
+      case SEEK_CUR:
+         pos += this->pos;
+         break;
+      case SEEK_END:
+         pos += base + size;
+         break;
+      default:
+         ERROR_SET(err, unknown, "Bad seek whence");
+      }
+
+      if (pos < 0)
+         ERROR_SET(err, unknown, "Seek to negative position");
+
+      this->pos = pos;
+   exit:;
+   }
+
+   size_t Read(void *buf, size_t len, error *err)
+   {
+      size_t r = 0;
+
+      if (pos >= base && pos - base < size)
+      {
+         r = MIN(len, size - (pos - base));
+         memcpy(buf, data + (pos - base), r);
+         pos += r;
+      }
+
+      return r;
+   }
+
+   void Substream(uint64_t off, uint64_t len, Stream **out, error *err)
+   {
+      file->Substream(off, len, out, err);
+   }
+
+   void
+   GetStreamInfo(common::StreamInfo *info, error *err)
+   {
+      file->GetStreamInfo(info, err);
+   }
+};
+
+void ParseMp4File(
+   Stream *stream,
+   ParsedMp4File &file,
+   error *err
+)
+{
+   bool sawMoov = false, sawMdat = false;
+
+   uint64_t len = stream->GetSize(err);
    ERROR_CHECK(err);
 
    try
    {
-      ParseBoxes(stream, len, [&file, &err, &stream, &sawMoov, &sawMdat]
+      ParseBoxes(stream, len, [&file, &err, &stream, &sawMoov, &sawMdat, len]
       (const ParsedBoxHeader &header)
       {
          if (!memcmp(header.Type, "moov", 4))
          {
-            ParseMoov(stream, header.Size, file.Moov, err);
+            // For a metadata scan we skip over the sample tables, so
+            // there's no point pulling them in.
+            //
+            if (!file.Moov.MetadataOnly && header.Size <= MoovReadLimit)
+            {
+               Pointer<Mp4MemoryStream> moov;
+
+               *moov.GetAddressOf() = new Mp4MemoryStream(stream);
+               moov->Initialize(header.Size, file.Mapping, err);
+               ERROR_CHECK(err);
+
+               ParseMoov(moov.Get(), header.Size, file.Moov, err);
+            }
+            else
+            {
+               ParseMoov(stream, header.Size, file.Moov, err);
+            }
             sawMoov = true;
          }
-         else if (!memcmp(header.Type, "mdat", 4))
+         else if (!memcmp(header.Type, "mdat", 4) && !file.Fragmented)
          {
             file.MdatStart = stream->GetPosition(err);
             ERROR_CHECK(err);
             file.MdatLength = header.Size;
             sawMdat = true;
          }
+         else if (!memcmp(header.Type, "moof", 4) && !file.Fragmented)
+         {
+            // Samples are described by moof boxes from here on, each
+            // followed by its own mdat.  The demuxer reads them as it goes.
+            //
+            file.FirstFragment = stream->GetPosition(err);
+            ERROR_CHECK(err);
+            file.FirstFragment -= header.HeaderLength;
+            file.Fragmented = true;
+            file.MdatStart = 0;
+            file.MdatLength = len;
+            sawMdat = true;
+         }
          if (sawMoov && sawMdat)
             throw Mp4ParseFinished();
       exit:;
@@ -1232,17 +1957,15 @@ void ParseMp4File(
 exit:;
 }
 
+class Mp4DemuxStream;
+
 struct Mp4SeekTable : public SeekTable
 {
    Pointer<Stream> refCount;
+   Mp4DemuxStream *demux;
    std::shared_ptr<Track> track;
-   int fileHeaderLen;
-   int packetHeaderLen;
 
-   Mp4SeekTable(Stream *refCount_, const std::shared_ptr<Track> &track_, int fileHeader, int packetHeader)
-      : refCount(refCount_), track(track_), fileHeaderLen(fileHeader), packetHeaderLen(packetHeader)
-   {
-   }
+   Mp4SeekTable(Mp4DemuxStream *demux_, const std::shared_ptr<Track> &track_);
 
    ~Mp4SeekTable()
    {
@@ -1251,48 +1974,135 @@ struct Mp4SeekTable : public SeekTable
    }
 
    bool
-   Lookup(uint64_t desiredTime, uint64_t &time, uint64_t &fileOffset, error *err)
+   Lookup(uint64_t desiredTime, uint64_t &time, uint64_t &fileOffset, error *err);
+};
+
+class Mp4DemuxStream : public Stream
+{
+   const void *fileHeader;
+   int fileHeaderLen;
+   uint64_t pos;
+   uint64_t fileSize;
+   PackedTable PacketStarts;
+   int currentPacket;
+   int currentChunk;
+   int samplesWithinChunk;
+   StscEntry *chunkLookup;
+
+   // Byte offset of the current sample from the start of its chunk, so
+   // that we don't have to add up the sizes of its predecessors.
+   //
+   uint64_t chunkSampleOffset;
+
+   // Where we left the underlying stream after the last read, or
+   // InvalidStreamPos if we don't know.
+   //
+   uint64_t streamPos;
+
+   static const uint64_t InvalidStreamPos = ~0ULL;
+
+   // For fragmented files: the next top-level box to look at for a moof,
+   // and whether we've run out.
+   //
+   uint64_t nextFragment;
+   uint64_t streamSize;
+   bool fragmentsDone;
+   StreamMapping mapping;
+
+   // Append PacketStarts for samples the track has gained.
+   //
+   void
+   AddPackets(error *err)
+   {
+      for (uint64_t i=PacketStarts.Size(); i<track->NumberOfSamples; ++i)
+      {
+         PacketStarts.Append(fileSize, err);
+         ERROR_CHECK(err);
+         fileSize += track->GetSampleSize(i, err);
+         ERROR_CHECK(err);
+      }
+   exit:;
+   }
+
+   // For fragmented files, find the next moof box with samples for our
+   // track and add them.  Returns false if there are no more.
+   //
+   bool
+   LoadFragment(error *err)
    {
-      int idx = 0;
       bool r = false;
+      size_t chunkLookupIdx = chunkLookup ? chunkLookup - track->SamplesInChunk.data() : 0;
+      uint64_t oldSamples = track->NumberOfSamples;
 
-      time = 0;
-      fileOffset = fileHeaderLen;
+      streamPos = InvalidStreamPos;
 
-      while (desiredTime)
+      while (!fragmentsDone && !r)
       {
-         auto ts = track->GetSampleDuration(idx, err);
-         ERROR_CHECK(err);
+         ParsedBoxHeader header;
+         uint64_t boxStart = nextFragment;
 
-         if (ts > desiredTime)
+         if (nextFragment >= streamSize)
+         {
+            fragmentsDone = true;
+            PacketStarts.Shrink();
+            track->SampleSizes.Shrink();
+            track->ChunkTable.Shrink();
             break;
+         }
 
-         fileOffset += packetHeaderLen + track->GetSampleSize(idx, err);
+         stream->Seek(nextFragment, SEEK_SET, err);
+         ERROR_CHECK(err);
+         ParseBoxHeader(stream.Get(), nullptr, header, err);
+         ERROR_CHECK(err);
+         nextFragment += header.HeaderLength + header.Size;
+
+         if (memcmp(header.Type, "moof", 4))
+            continue;
+
+         if (header.Size <= MoovReadLimit)
+         {
+            Pointer<Mp4MemoryStream> moof;
+
+            try
+            {
+               *moof.GetAddressOf() = new Mp4MemoryStream(stream.Get());
+            }
+            catch (const std::bad_alloc&)
+            {
+               ERROR_SET(err, nomem);
+            }
+            moof->Initialize(header.Size, mapping, err);
+            ERROR_CHECK(err);
+
+            ParseMoof(moof.Get(), boxStart, header.Size, *track, err);
+            ERROR_CHECK(err);
+         }
+         else
+         {
+            ParseMoof(stream.Get(), boxStart, header.Size, *track, err);
+            ERROR_CHECK(err);
+         }
+
+         AddPackets(err);
          ERROR_CHECK(err);
 
-         desiredTime -= ts;
-         time += ts;
-         ++idx;
+         r = (track->NumberOfSamples != oldSamples);
       }
 
-      r = true;
    exit:
+      if (track->SamplesInChunk.size())
+         chunkLookup = track->SamplesInChunk.data() + chunkLookupIdx;
       return r;
    }
-};
 
-class Mp4DemuxStream : public Stream
-{
-   const void *fileHeader;
-   int fileHeaderLen;
-   int packetHeaderLen;
-   uint64_t pos;
-   uint64_t fileSize;
-   std::vector<uint64_t> PacketStarts;
-   int currentPacket;
-   int currentChunk;
-   int samplesWithinChunk;
-   StscEntry *chunkLookup;
+   // Load fragments until the stream is at least @size bytes, or it ends.
+   //
+   void
+   LoadFragmentsUntilSize(uint64_t size, error *err)
+   {
+      while (fileSize < size && LoadFragment(err))
+         ;
+   }
 
 protected:
 
@@ -1300,17 +2110,21 @@ protected:
    uint64_t MdatStart, MdatLength;
    std::shared_ptr<Track> track;
 
-   int GetCurrentPacket() const { return currentPacket; }
+public:
 
-   virtual void
-   GetFileHeader(const void **buf, int *len, error *err)
+   // Where packet @idx starts in our output; the number of packets
+   // gives the end of the stream.
+   //
+   uint64_t
+   GetPacketStart(uint64_t idx)
    {
-      *buf = nullptr;
-      *len = 0;
+      return (idx < PacketStarts.Size()) ? PacketStarts.Get(idx) : fileSize;
    }
 
+protected:
+
    virtual void
-   GetPacketHeader(uint32_t packetLength, const void **buf, int *len, error *err)
+   GetFileHeader(const void **buf, int *len, error *err)
    {
       *buf = nullptr;
       *len = 0;
@@ -1326,6 +2140,12 @@ public:
        currentChunk(0),
        samplesWithinChunk(0),
        chunkLookup(nullptr),
+       chunkSampleOffset(0),
+       streamPos(InvalidStreamPos),
+       nextFragment(mp4.FirstFragment),
+       streamSize(0),
+       fragmentsDone(!mp4.Fragmented),
+       mapping(mp4.Mapping),
        stream(stream_),
        MdatStart(mp4.MdatStart),
        MdatLength(mp4.MdatLength),
@@ -1336,14 +2156,32 @@ public:
    virtual void
    Initialize(error *err)
    {
-      const void *dummyBuf;
-
       GetFileHeader(&fileHeader, &fileHeaderLen, err);
       ERROR_CHECK(err);
 
-      GetPacketHeader(0, &dummyBuf, &packetHeaderLen, err);
+      // Subclasses may have moved the stream to read codec config.
+      //
+      streamPos = InvalidStreamPos;
+
+      fileSize = fileHeaderLen;
+      AddPackets(err);
       ERROR_CHECK(err);
 
+      if (fragmentsDone)
+         PacketStarts.Shrink();
+      else
+      {
+         // Only wait for the first fragment, the rest can come later.
+         //
+         streamSize = stream->GetSize(err);
+         ERROR_CHECK(err);
+         if (!track->NumberOfSamples)
+         {
+            LoadFragment(err);
+            ERROR_CHECK(err);
+         }
+      }
+
       if (!track->NumberOfSamples)
          ERROR_SET(err, unknown, "No samples");
 
@@ -1352,30 +2190,38 @@ public:
 
       chunkLookup = track->SamplesInChunk.data();
 
-      fileSize = fileHeaderLen;
-      try
-      {
-         for (int i=0; i<track->NumberOfSamples; ++i)
-         {
-            PacketStarts.push_back(fileSize);
-            fileSize += packetHeaderLen;
-            fileSize += track->GetSampleSize(i, err);
-            ERROR_CHECK(err);
-         }
-      }
-      catch (const std::bad_alloc&)
-      {
-         ERROR_SET(err, nomem);
-      }
-
    exit:;
    }
 
+   // For a fragmented file this has to find every moof box, but it
+   // doesn't read their samples.
+   //
    uint64_t GetSize(error *err)
    {
+      LoadFragmentsUntilSize(~0ULL, err);
       return fileSize;
    }
 
+   // For fragmented files, load moof boxes until packet @idx is known.
+   // Returns false if the track has fewer packets.
+   //
+   bool
+   HavePacket(uint64_t idx, error *err)
+   {
+      while (idx >= PacketStarts.Size() && LoadFragment(err))
+         ;
+      return idx < PacketStarts.Size();
+   }
+
+   // For fragmented files, make sure the track's tables reach @time.
+   //
+   void
+   LoadFragmentsUntilTime(uint64_t time, error *err)
+   {
+      while (track->GetIndexedDuration() <= time && LoadFragment(err))
+         ;
+   }
+
    uint64_t GetPosition(error *err)
    {
       return pos;
@@ -1383,7 +2229,6 @@ public:
 
    void Seek(int64_t pos, int whence, error *err)
    {
-      uint64_t *nearestPacket;
       int chunks = 0;
       int pkt;
 
@@ -1395,43 +2240,34 @@ public:
          Seek(this->pos + pos, SEEK_SET, err);
          return;
       case SEEK_END:
+         LoadFragmentsUntilSize(~0ULL, err);
+         ERROR_CHECK(err);
          Seek(fileSize + pos, SEEK_SET, err);
          return;
       default:
          ERROR_SET(err, unknown, "Bad seek whence");
       }
 
+      if (pos > 0)
+      {
+         LoadFragmentsUntilSize(pos + 1, err);
+         ERROR_CHECK(err);
+      }
+
       // Set pos...
       //
       this->pos = MIN(fileSize, MAX(0LL, pos));
+      streamPos = InvalidStreamPos;
 
       if (this->pos == fileSize)
       {
-         this->currentPacket = PacketStarts.size();
+         this->currentPacket = PacketStarts.Size();
          return;
       }
 
       // Find sample...
       //
-      nearestPacket = bsearch_nearest_match(
-         this->pos,
-         PacketStarts.data(),
-         PacketStarts.size(),
-         [] (uint64_t a, uint64_t b) -> int
-         {
-            if (a < b)
-               return -1;
-            if (a > b)
-               return 1;
-            return 0;
-         } 
-      );
-      if (!nearestPacket)
-         ERROR_SET(err, unknown, "Couldn't find packet");
-      while (nearestPacket != PacketStarts.data() &&
-             *nearestPacket > this->pos)
-         --nearestPacket;
-      currentPacket = nearestPacket - PacketStarts.data();
+      currentPacket = PacketStarts.FindLast(this->pos);
 
       //
       // Find chunk...
@@ -1453,6 +2289,10 @@ public:
          pkt -= chunkLookup->SamplesPerChunk;
       }
 
+      chunkSampleOffset =
+         PacketStarts.Get(currentPacket) -
+         PacketStarts.Get(currentPacket - samplesWithinChunk);
+
    exit:;
    }
 
@@ -1469,16 +2309,49 @@ public:
       }
    }
 
+   uint64_t
+   GetPacketEnd(int idx)
+   {
+      return GetPacketStart(idx + 1);
+   }
+
+   // Move on to the next sample, and the next chunk if this one is done.
+   //
+   void
+   NextPacket(void)
+   {
+      uint64_t start = GetPacketStart(currentPacket);
+
+      chunkSampleOffset += GetPacketEnd(currentPacket) - start;
+      ++currentPacket;
+      if (++samplesWithinChunk >= chunkLookup->SamplesPerChunk)
+      {
+         ++currentChunk;
+         samplesWithinChunk = 0;
+         chunkSampleOffset = 0;
+         AdvanceChunkLookup();
+      }
+   }
+
    size_t Read(void *buf, size_t len, error *err)
    {
       size_t r = 0;
-      uint32_t currentPacketLen;
       uint32_t offset;
       uint64_t chunkOffset = 0;
-      const void *packetHeader;
+      int chunkEnd = 0;
 
    retry:
-      if (!len || currentPacket >= PacketStarts.size())
+      if (len && currentPacket >= PacketStarts.Size() && !fragmentsDone)
+      {
+         if (!LoadFragment(err))
+         {
+            ERROR_CHECK(err);
+            goto exit;
+         }
+         AdvanceChunkLookup();
+      }
+
+      if (!len || currentPacket >= PacketStarts.Size())
          goto exit;
 
       if (!currentPacket &&
@@ -1497,79 +2370,50 @@ public:
          }
       }
 
-      if (currentPacket + 1 == PacketStarts.size())
-         currentPacketLen = fileSize - PacketStarts[currentPacket];
-      else
-         currentPacketLen = PacketStarts[currentPacket+1] - PacketStarts[currentPacket];
-
-      offset = pos - PacketStarts[currentPacket];
-      if (packetHeaderLen && offset < packetHeaderLen)
-      {
-         size_t headerRemaining = packetHeaderLen - offset;
-         size_t n = MIN(headerRemaining, len);
-
-         GetPacketHeader(currentPacketLen, &packetHeader, &packetHeaderLen, err);
-         ERROR_CHECK(err);
-
-         memcpy(buf, (const char*)packetHeader + offset, n);
-         buf = (char*)buf + n;
-         pos += n;
-         r += n;
-         offset += n;
-         len -= n;
-         if (!len) goto exit;
-      }
+      offset = pos - GetPacketStart(currentPacket);
 
       track->GetChunkOffset(currentChunk, &chunkOffset, err);
       ERROR_CHECK(err);
 
-      for (int i=0; i<samplesWithinChunk; ++i)
-      {
-         auto n = track->GetSampleSize(currentPacket - i - 1, err);
-         ERROR_CHECK(err);
-         chunkOffset += n;
-      }
+      // The rest of the chunk is contiguous in the file and in our
+      // output, so take as much of it as the caller has room for.
+      //
+      chunkEnd = currentPacket - samplesWithinChunk + chunkLookup->SamplesPerChunk;
 
       {
-         auto n = track->GetSampleSize(currentPacket, err);
+         uint64_t n = GetPacketEnd(MIN(chunkEnd, (int)PacketStarts.Size()) - 1) - pos;
          size_t r2 = 0;
-         ERROR_CHECK(err);
-         offset -= packetHeaderLen;
-         chunkOffset += offset;
-         n -= offset;
+
+         chunkOffset += chunkSampleOffset + offset;
+
          if (chunkOffset < MdatStart ||
              chunkOffset + n > MdatStart + MdatLength)
          {
             ERROR_SET(err, unknown, "chunk lies outside mdat box");
          }
-         stream->Seek(chunkOffset, SEEK_SET, err);
-         ERROR_CHECK(err);
+         if (chunkOffset != streamPos)
+         {
+            streamPos = InvalidStreamPos;
+            stream->Seek(chunkOffset, SEEK_SET, err);
+            ERROR_CHECK(err);
+         }
          r2 = stream->Read(buf, MIN(n, len), err);
          ERROR_CHECK(err);
          if (r2 <= 0) goto exit;
+         streamPos = chunkOffset + r2;
          buf = (char*)buf + r2;
          len -= r2;
-         n -= r2;
          r += r2;
          pos += r2;
-         if (!n)
+         while (currentPacket < PacketStarts.Size() &&
+                pos >= GetPacketEnd(currentPacket))
          {
-            ++currentPacket;
-            ++samplesWithinChunk;
-            if (samplesWithinChunk >= chunkLookup->SamplesPerChunk)
-            {
-               ++currentChunk;
-               samplesWithinChunk = 0;
-            }
+            NextPacket();
          }
-         else
-         {
+         if (r2 < n)
             goto exit;
-         }
       }
 
-      AdvanceChunkLookup();
-
       if (len)
          goto retry;
 
@@ -1584,7 +2428,7 @@ public:
          goto exit;
       try
       {
-         ptr = std::make_shared<Mp4SeekTable>(this, track, fileHeaderLen, packetHeaderLen);
+         ptr = std::make_shared<Mp4SeekTable>(this, track);
       }
       catch (const std::bad_alloc&)
       {
@@ -1600,6 +2444,30 @@ public:
    }
 };
 
+Mp4SeekTable::Mp4SeekTable(Mp4DemuxStream *demux_, const std::shared_ptr<Track> &track_)
+   : refCount(demux_), demux(demux_), track(track_)
+{
+}
+
+bool
+Mp4SeekTable::Lookup(uint64_t desiredTime, uint64_t &time, uint64_t &fileOffset, error *err)
+{
+   uint64_t idx = 0;
+   bool r = false;
+
+   demux->LoadFragmentsUntilTime(desiredTime, err);
+   ERROR_CHECK(err);
+
+   track->FindSampleByTime(desiredTime, idx, time, err);
+   ERROR_CHECK(err);
+
+   fileOffset = demux->GetPacketStart(idx);
+
+   r = true;
+exit:
+   return r;
+}
+
 class Mp4DemuxStreamWithSimpleHeader : public Mp4DemuxStream
 {
    const void *header;
@@ -1626,136 +2494,203 @@ protected:
    }
 };
 
-class AacDemuxStream : public Mp4DemuxStream
+//
+// Hands a codec the track's samples one at a time.  They are read into
+// our buffer a chunk or more at a time, and handed out from there.
+//
+class Mp4PacketDemuxer : public PacketDemuxer
 {
-   unsigned char adts[7];
+   Pointer<Mp4DemuxStream> demux;
+   std::shared_ptr<Track> track;
+   uint64_t nextPacket;
+   std::vector<unsigned char> buffer;
+   uint64_t bufferStart;
+   size_t bufferLen;
+
+   enum { MinimumRead = 64 * 1024 };
+
+   // Make sure bytes @start to @end of the demuxed stream are in the
+   // buffer.  Anything we already have from that range is kept.
+   //
+   void
+   Fill(uint64_t start, uint64_t end, error *err)
+   {
+      size_t keep = 0;
+      uint64_t want = 0;
+
+      if (start >= bufferStart && end <= bufferStart + bufferLen)
+         goto exit;
+
+      if (start >= bufferStart && start < bufferStart + bufferLen)
+      {
+         keep = bufferStart + bufferLen - start;
+         memmove(buffer.data(), buffer.data() + (start - bufferStart), keep);
+      }
+      else
+      {
+         uint64_t pos = demux->GetPosition(err);
+         ERROR_CHECK(err);
+         if (pos != start)
+         {
+            demux->Seek(start, SEEK_SET, err);
+            ERROR_CHECK(err);
+         }
+      }
+
+      bufferStart = start;
+      bufferLen = keep;
+
+      want = MAX(end - start, (uint64_t)MinimumRead);
+      if (want >= (1ULL<<32))
+         ERROR_SET(err, unknown, "Packet too big");
+      if (buffer.size() < want)
+      {
+         try
+         {
+            buffer.resize(want);
+         }
+         catch (const std::bad_alloc&)
+         {
+            ERROR_SET(err, nomem);
+         }
+      }
+
+      while (bufferLen < end - start)
+      {
+         size_t r = demux->Read(buffer.data() + bufferLen, buffer.size() - bufferLen, err);
+         ERROR_CHECK(err);
+         if (!r)
+            ERROR_SET(err, unknown, "Short read");
+         bufferLen += r;
+      }
+
+   exit:
+      if (ERROR_FAILED(err))
+         bufferLen = 0;
+   }
 
 public:
-   AacDemuxStream(
-      Stream *stream,
-      const ParsedMp4File& mp4,
-      int trackIdx
-   )
-      : Mp4DemuxStream(stream, mp4, trackIdx)
+
+   Mp4PacketDemuxer(Mp4DemuxStream *demux_, const std::shared_ptr<Track> &track_)
+      : demux(demux_),
+        track(track_),
+        nextPacket(0),
+        bufferStart(0),
+        bufferLen(0)
    {
-      memset(&adts, 0, sizeof(adts));
    }
 
-   void
-   Initialize(error *err)
+   bool
+   ReadPacket(Packet &packet, error *err)
    {
-      uint64_t length;
-      unsigned char dummy[16];
-      unsigned char config[0x2];
-      unsigned char objectType;
-      unsigned char freq;
-      unsigned char channels;
+      bool r = false;
+      uint64_t start = 0, end = 0;
 
-      // Sync word + protection absent
-      //
-      adts[0] = 0xff;
-      adts[1] = 0xf1;
+      if (!demux->HavePacket(nextPacket, err))
+         goto exit;
 
-      // Buffer fullness
-      adts[5] = 0x1f;
-      adts[6] = 0xfc;
+      start = demux->GetPacketStart(nextPacket);
+      end = demux->GetPacketStart(nextPacket + 1);
 
-      stream->Seek(track->CodecBoxOffset, SEEK_SET, err);
+      Fill(start, end, err);
       ERROR_CHECK(err);
-      length = track->CodecBoxLength;
 
-      ::Read(stream.Get(), &dummy, 4, &length, err);
+      packet.Data = buffer.data() + (start - bufferStart);
+      packet.Size = end - start;
+      packet.Timestamp = track->GetSampleTime(nextPacket);
+      packet.Duration = track->DurationPerSample.size() ?
+         track->GetSampleDuration(nextPacket, err) : 0;
       ERROR_CHECK(err);
 
-      ReadEsDescriptor(stream.Get(), length, 0x03, err);
-      ERROR_CHECK(err);
-      ::Read(stream.Get(), &dummy, 3, &length, err);
-      ERROR_CHECK(err);
+      ++nextPacket;
+      r = true;
+   exit:
+      return r;
+   }
 
-      ReadEsDescriptor(stream.Get(), length, 0x04, err);
-      ERROR_CHECK(err);
-      ::Read(stream.Get(), &dummy, 13, &length, err);
-      ERROR_CHECK(err);
+   void
+   SeekPacket(uint64_t time, uint64_t &actualTime, error *err)
+   {
+      uint64_t idx = 0;
 
-      ReadEsDescriptor(stream.Get(), length, 0x05, err);
+      demux->LoadFragmentsUntilTime(time, err);
       ERROR_CHECK(err);
 
-      stream->Read(&config, sizeof(config), err);
+      track->FindSampleByTime(time, idx, actualTime, err);
       ERROR_CHECK(err);
 
-      objectType = (config[0] >> 3);
-      if (objectType == 31)
-         ERROR_SET(err, unknown, "Object type not supported");
-      freq = ((config[0] & 0x7) << 1) | (config[1] >> 7);
-      if (freq == 15)
-         ERROR_SET(err, unknown, "Sample rate not supported");
-      channels = (config[1] & 0x7f) >> 3; 
-
-      if (!objectType || objectType >= 4)
-         ERROR_SET(err, unknown, "Object type not supported");
-      if (!channels || channels >= 8)
-         ERROR_SET(err, unknown, "Channel configuration not supported");
-
-      adts[2] |= ((objectType - 1) << 6);
-      adts[2] |= (freq << 2);
-      adts[2] |= ((channels >> 2) ? 1 : 0);
-      adts[3] |= (channels << 6);
-
-      Mp4DemuxStream::Initialize(err);
-      ERROR_CHECK(err);
+      nextPacket = idx;
    exit:;
    }
 
-protected:
-
-   void
-   GetPacketHeader(uint32_t packetLength, const void **buf, int *len, error *err)
+   uint64_t
+   GetDuration(error *err)
    {
-      if (packetLength >= 16384)
-         ERROR_SET(err, unknown, "Invalid ADTS packet length");
+      uint64_t r = 0;
 
-      adts[3] &= ~0x3;
-      adts[4] = 0;
-      adts[5] &= ~0xe0;
+      demux->GetSize(err);
+      ERROR_CHECK(err);
 
-      adts[3] |= (packetLength >> 11); 
-      adts[4] = (packetLength >> 3);
-      adts[5] |= (packetLength&7) << 5;
+      r = track->GetIndexedDuration();
+   exit:
+      return r;
+   }
 
-      *buf = adts;
-      *len = sizeof(adts);
-   exit:;
+   void
+   GetStreamInfo(common::StreamInfo *info, error *err)
+   {
+      demux->GetStreamInfo(info, err);
    }
-}; 
+};
 
-class StreamForMicroCodec : public Mp4DemuxStream
+// The esds box holds the AudioSpecificConfig a few descriptors deep.  Trim
+// @config, the box's contents, down to just that.
+//
+void
+ExtractAacConfig(std::vector<unsigned char> &config, error *err)
 {
-   MicroCodecDemux header;
-
-protected:
+   static const struct
+   {
+      unsigned char Tag;
+      uint32_t Skip;
+   } descriptors[] =
+   {
+      {0x03, 3},
+      {0x04, 13},
+      {0x05, 0},
+   };
+   size_t off = 4;
+   uint32_t len = 0;
 
-   void
-   GetPacketHeader(uint32_t packetLength, const void **buf, int *len, error *err)
+   for (auto &desc : descriptors)
    {
-      header.FrameSize = packetLength - sizeof(header);
-      header.Duration = track->DurationPerSample.size() ? track->GetSampleDuration(GetCurrentPacket(), err) : 0;
-      ERROR_CHECK(err);
+      if (off >= config.size() || config[off++] != desc.Tag)
+         ERROR_SET(err, unknown, "Unexpected ES tag");
 
-      *buf = &header;
-      *len = sizeof(header);
-   exit:;
+      len = 0;
+      for (int i=0; i<4; ++i)
+      {
+         unsigned char ch = 0;
+
+         if (off >= config.size())
+            ERROR_SET(err, unknown, "esds box too short");
+         ch = config[off++];
+         len <<= 7;
+         len |= (ch & 0x7f);
+         if (!(ch & 0x80))
+            break;
+      }
+
+      off += desc.Skip;
    }
 
-public:
+   if (off > config.size() || config.size() - off < len)
+      ERROR_SET(err, unknown, "esds box too short");
 
-   StreamForMicroCodec(
-      Stream *stream,
-      const ParsedMp4File& mp4,
-      int trackIdx
-   )
-      : Mp4DemuxStream(stream, mp4, trackIdx)
-   {}
-};
+   memmove(config.data(), config.data() + off, len);
+   config.resize(len);
+exit:;
+}
 
 template <class CreateFn, class ProcessConfig>
 std::function<void(Stream*, CodecArgs *, Source**, error*)>
@@ -1766,6 +2701,7 @@ CreateFromMicroCodec(const ParsedMp4File &mp4, int i, Stream *mp4Stream_, Create
    return [track, mp4Stream, createFn, cfgFn] (Stream *stream, CodecArgs *params, Source **out, error *err) -> void
    {
       Pointer<MicroCodec> uc;
+      Pointer<Mp4PacketDemuxer> demux;
       std::vector<unsigned char> config;
       uint64_t oldPos = 0;
 
@@ -1785,6 +2721,10 @@ CreateFromMicroCodec(const ParsedMp4File &mp4, int i, Stream *mp4Stream_, Create
          ERROR_CHECK(err);
          cfgFn(config, err);
          ERROR_CHECK(err);
+
+         // The stream handed to us is the Mp4DemuxStream for this track.
+         //
+         *demux.GetAddressOf() = new Mp4PacketDemuxer((Mp4DemuxStream*)stream, track);
       }
       catch (const std::bad_alloc&)
       {
@@ -1793,7 +2733,7 @@ CreateFromMicroCodec(const ParsedMp4File &mp4, int i, Stream *mp4Stream_, Create
 
       createFn(uc.GetAddressOf(), err);
       ERROR_CHECK(err);
-      AudioSourceFromMicroCodec(uc.Get(), stream, params->Duration, config.data(), config.size(), out, err);
+      AudioSourceFromMicroCodec(uc.Get(), demux.Get(), params->Duration, config.data(), config.size(), out, err);
       ERROR_CHECK(err);
 
       mp4Stream->Seek(oldPos, SEEK_SET, err);
@@ -1809,6 +2749,7 @@ struct Mp4Codec : public Codec
    Mp4Codec() : MetadataOnly(false) {}
 
    int GetBytesRequiredForDetection() { return 8; }
+   FileType GetFileType() { return FileTypeMp4; }
 
    void TryOpen(
       common::Stream *file,
@@ -1843,6 +2784,7 @@ struct Mp4Codec : public Codec
 
       mp4.Moov.Metadata = params.Metadata;
       mp4.Moov.MetadataOnly = this->MetadataOnly;
+      mp4.Mapping = params.Mapping;
 
       ParseMp4File(file, mp4, err);
       ERROR_CHECK(err);
@@ -1859,12 +2801,20 @@ struct Mp4Codec : public Codec
             case Track::Aac:
                codecName = "AAC";
                *demux.GetAddressOf() =
-                  new AacDemuxStream(file, mp4, i);
-               // Seek with AAC is already fast, since we cook up ADTS headers
-               // in RAM and don't go to disk to seek.  Save some memory by
-               // clearing out stts when the seek table object dies.
+                  new Mp4DemuxStream(file, mp4, i);
+               create = CreateFromMicroCodec(
+                  mp4,
+                  i,
+                  file,
+                  CreateOpenCoreAacMicroCodec,
+                  ExtractAacConfig,
+                  err
+               );
+               ERROR_CHECK(err);
+               // Packets are timed from stts, so it has to outlive the
+               // codec, and seeks go through the demuxer anyway.
                //
-               seekTable = CreateSeekTable;
+               seekTable = SuppressSeekTable;
                break;
 #endif
 #if defined(USE_OPENCORE_MP3)
@@ -1902,7 +2852,7 @@ struct Mp4Codec : public Codec
             case Track::Alac:
                codecName = "Apple Lossless";
                *demux.GetAddressOf() =
-                  new StreamForMicroCodec(file, mp4, i);
+                  new Mp4DemuxStream(file, mp4, i);
                create = CreateFromMicroCodec(
                   mp4,
                   i,
@@ -1935,6 +2885,12 @@ struct Mp4Codec : public Codec
             duration = (demux.Get() && track.TimeScale) ?
                           track.MediaDuration * (10000000.0 / track.TimeScale) :
                           0;
+
+            // Fragmented files usually leave mdhd empty and give the
+            // duration in mehd instead.
+            //
+            if (demux.Get() && !duration && mp4.Moov.TimeScale)
+               duration = mp4.Moov.FragmentDuration * (10000000.0 / mp4.Moov.TimeScale);
          }
       }
       catch (const std::bad_alloc&)
@@ -1962,6 +2918,13 @@ struct Mp4Codec : public Codec
          params.SeekTable = seekTableObj;
       }
 
+      // The codec reads from the demuxer, not the file, so nothing that
+      // describes the file applies to it.
+      //
+      params.Mapping = StreamMapping();
+      params.DurationStream = nullptr;
+      params.FrameIndex.reset();
+
       create(demux.Get(), &params, obj, err);
       ERROR_CHECK(err);
 
@@ -0,0 +1,201 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef mpegheader_h_
+#define mpegheader_h_
+
+#include <common/misc.h>
+
+namespace audio {
+
+//
+// Frame headers for MPEG audio and ADTS, shared by the sniffer, the
+// decoders and their duration scans.  These only look at the header
+// bytes, so they are safe on any thread and cheap enough to try at every
+// 0xff in a buffer.
+//
+
+const int MpegAudioHeaderBytes = 4;
+const int AdtsHeaderBytes = 7;
+
+struct MpegAudioHeader
+{
+   int MpegVersion;        // 1 or 2; 2 for MPEG-2.5 also
+   bool Mpeg25;
+   int Layer;
+   int Bitrate;            // kbit/s
+   int SampleRate;
+   int Channels;
+   bool Protection;
+   int SamplesPerFrame;
+   int FrameSize;          // in bytes, header and padding included
+
+   // Header bits that stay the same from one frame of a stream to the
+   // next: version, layer, protection and sample rate.
+   //
+   unsigned Key;
+};
+
+// Parses the MpegAudioHeaderBytes header at @p.  Returns false if it
+// isn't a valid one.  ADTS has the same sync word and layer 0, so it's
+// rejected here.
+//
+inline bool
+ParseMpegAudioHeader(const unsigned char *p, MpegAudioHeader &header)
+{
+   static const int bitrates[2][3][15] =
+   {
+      // mpeg1, layers I, II, III
+      {
+         {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448},
+         {0, 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384},
+         {0, 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320},
+      },
+      // mpeg2 and 2.5
+      {
+         {0, 32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256},
+         {0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160},
+         {0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160},
+      },
+   };
+   static const int sampleRates[3][3] =
+   {
+      {44100, 48000, 32000},
+      {22050, 24000, 16000},
+      {11025, 12000,  8000},
+   };
+   int version = 0, bitrate = 0, sampleRate = 0, padding = 0;
+
+   if (p[0] != 0xff || (p[1] & 0xe0) != 0xe0)
+      return false;
+
+   header.Layer = 4 - ((p[1] >> 1) & 3);
+   if (header.Layer == 4)
+      return false;
+
+   // 0, 1, 2 for MPEG-1, 2 and 2.5.
+   //
+   switch ((p[1] >> 3) & 3)
+   {
+   case 3:
+      version = 0;
+      break;
+   case 2:
+      version = 1;
+      break;
+   case 0:
+      if (header.Layer != 3)
+         return false;
+      version = 2;
+      break;
+   default:
+      return false;
+   }
+
+   bitrate = p[2] >> 4;
+   sampleRate = (p[2] >> 2) & 3;
+   if (!bitrate || bitrate == 0xf || sampleRate == 3)
+      return false;
+
+   padding = (p[2] >> 1) & 1;
+
+   header.MpegVersion = version ? 2 : 1;
+   header.Mpeg25 = (version == 2);
+   header.Bitrate = bitrates[version ? 1 : 0][header.Layer - 1][bitrate];
+   header.SampleRate = sampleRates[version][sampleRate];
+   header.Channels = ((p[3] >> 6) == 3) ? 1 : 2;
+   header.Protection = !(p[1] & 1);
+
+   switch (header.Layer)
+   {
+   case 1:
+      header.SamplesPerFrame = 384;
+      header.FrameSize = (12000 * header.Bitrate / header.SampleRate + padding) * 4;
+      break;
+   case 3:
+      if (version)
+      {
+         header.SamplesPerFrame = 576;
+         header.FrameSize = 72000 * header.Bitrate / header.SampleRate + padding;
+         break;
+      }
+      // fall through
+   default:
+      header.SamplesPerFrame = 1152;
+      header.FrameSize = 144000 * header.Bitrate / header.SampleRate + padding;
+   }
+
+   header.Key = ((p[1] & 0xfe) << 8) | (p[2] & 0x0c);
+   return true;
+}
+
+// Sample rates and channel counts by their index in ADTS headers and
+// AudioSpecificConfig.
+//
+const int AacSampleRates[] =
+{
+   96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000,
+   12000, 11025,  8000,  7350,
+};
+
+const int AacChannels[] =
+{
+   0, 1, 2, 3, 4, 5, 6, 8
+};
+
+struct AdtsHeader
+{
+   int MpegVersion;        // 2 or 4
+   int SampleRate;
+   int Channels;
+   int SamplesPerFrame;    // before SBR; the decoder may double it
+   int FrameSize;          // in bytes, header included
+
+   // Header bits that stay the same from one frame of a stream to the
+   // next: version, profile, sample rate and channels.  Never equal to
+   // an MpegAudioHeader's Key.
+   //
+   unsigned Key;
+};
+
+// Parses the AdtsHeaderBytes header at @p.  Returns false if it isn't a
+// valid one.
+//
+inline bool
+ParseAdtsHeader(const unsigned char *p, AdtsHeader &header)
+{
+   int sampleRate = 0, channels = 0;
+
+   // All 12 sync bits set, and layer 0.
+   //
+   if (p[0] != 0xff || (p[1] & 0xf6) != 0xf0)
+      return false;
+
+   sampleRate = (p[2] >> 2) & 0xf;
+   if (sampleRate >= ARRAY_SIZE(AacSampleRates))
+      return false;
+
+   channels = ((p[2] & 1) << 2) | (p[3] >> 6);
+   if (!channels)
+      return false;
+
+   header.FrameSize = ((p[3] & 3) << 11) | (p[4] << 3) | (p[5] >> 5);
+   if (header.FrameSize < AdtsHeaderBytes)
+      return false;
+
+   header.MpegVersion = ((p[1] >> 3) & 1) ? 2 : 4;
+   header.SampleRate = AacSampleRates[sampleRate];
+   header.Channels = AacChannels[channels];
+   header.SamplesPerFrame = 1024 * ((p[6] & 3) + 1);
+   header.Key = ((p[1] & 0xfe) << 16) | ((p[2] & 0xfd) << 8) | (p[3] & 0xc0);
+   return true;
+}
+
+} // end namespace
+
+#endif
@@ -27,6 +27,11 @@ public:
       return 0x1c + 8;
    }
 
+   FileType GetFileType()
+   {
+      return FileTypeOgg;
+   }
+
    void TryOpen(
       common::Stream *file,
       const void *firstBuffer,
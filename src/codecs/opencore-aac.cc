@@ -7,11 +7,16 @@
 */
 
 #include <AudioCodec.h>
+#include <MicroCodec.h>
 #include <common/misc.h>
 #include <common/logger.h>
 #include <common/c++/new.h>
 
 #include "seekbase.h"
+#include "carryover.h"
+#include "decoderpool.h"
+#include "mpegheader.h"
+#include "syncscan.h"
 
 #include <errno.h>
 #include <string.h>
@@ -24,76 +29,129 @@ using namespace audio;
 
 namespace {
 
-const int HEADER_SIZE = 7;
+const int HEADER_SIZE = AdtsHeaderBytes;
 
-struct ParsedFrameHeader
+void ParseHeader(
+   const unsigned char header[HEADER_SIZE],
+   AdtsHeader& parsed,
+   error *err
+)
 {
-   int MpegVersion;
-   int SampleRate;
-   int Channels;
-   int FrameSize;
-   int SamplesPerFrame;
-};
+   if (!ParseAdtsHeader(header, parsed))
+      ERROR_SET(err, unknown, "Bad ADTS frame header");
+exit:;
+}
+
+// The decoder's frameLength.  It doesn't do 960.
+//
+const int FRAME_LENGTH = 1024;
 
-bool IsSyncWord(const unsigned char *p)
+// Samples per channel that the decoder may write for one frame.
+//
+int
+GetOutputSamples(const AdtsHeader &header)
 {
-   return (p[0] == 0xff) && ((p[1] & 0xf0) == 0xf0);
+   // With aacPlusEnabled, SBR doubles the frame, and for implicit SBR
+   // we don't know until the first one is decoded.
+   //
+   // XXX, the decoder seems to assume a stereo output buffer
+   // for mono files.
+   //
+   return header.SamplesPerFrame * 2 * (header.Channels == 1 ? 2 : 1);
 }
 
-void ParseHeader(
-   const unsigned char header[HEADER_SIZE],
-   ParsedFrameHeader& parsed,
-   error *err
-)
+// Points the decoder at @buf, which has room for GetOutputSamples().
+// With SBR, the second half of the frame goes to pOutputBuffer_plus,
+// which is laid out for two channels just like the first.
+//
+void
+SetOutputBuffer(tPVMP4AudioDecoderExternal &ext, void *buf)
 {
-   static const int SampleRates[] =
-   {
-      96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000,
-      12000, 11025,  8000,  7350,
-   }; 
-   static const int Channels[] =
+   ext.pOutputBuffer = (Int16*)buf;
+   ext.pOutputBuffer_plus = ext.pOutputBuffer + 2 * FRAME_LENGTH;
+}
+
+// After a decode, the samples per channel that are at pOutputBuffer.
+//
+int
+GetDecodedSamples(tPVMP4AudioDecoderExternal &ext)
+{
+   int n = ext.frameLength;
+
+   if (ext.aacPlusUpsamplingFactor == 2)
    {
-      0, 1, 2, 3, 4, 5, 6, 8
-   };
-   int layer = 0, sampleRate = 0, channels = 0;
+      // Mono is packed at the start of each half; close the gap.
+      //
+      if (ext.desiredChannels == 1)
+         memmove(ext.pOutputBuffer + n, ext.pOutputBuffer_plus, n * sizeof(Int16));
+      n *= 2;
+   }
+   return n;
+}
 
-   if (!IsSyncWord(header))
-      ERROR_SET(err, unknown, "Bad frame header - no sync word");
+// Frame length callback for FindFrameRun() and ResyncStream().
+//
+int
+GetFrameLength(const unsigned char *p, int len, unsigned &key)
+{
+   AdtsHeader header;
 
-   layer = (header[1] >> 1) & 0x3;
-   if (layer != 0)
-      ERROR_SET(err, unknown, "Not an AAC header - perhaps MP3?");
+   if (len < HEADER_SIZE || !ParseAdtsHeader(p, header))
+      return 0;
 
-   parsed.MpegVersion = ((header[1]>>3)&1) ? 4 : 2;
+   key = header.Key;
+   return header.FrameSize;
+}
 
-   sampleRate = (header[2] >> 2) & 0xf;
-   if (sampleRate >= ARRAY_SIZE(SampleRates))
-      ERROR_SET(err, unknown, "Invalid sample rate");
+void
+error_set_pvmp4(error *err, int32_t code)
+{
+   const char *msg = "frame decode error";
 
-   parsed.SampleRate = SampleRates[sampleRate];
+   switch (code)
+   {
+   case MP4AUDEC_INVALID_FRAME:
+      msg = "Invalid frame";
+      break;
+   case MP4AUDEC_INCOMPLETE_FRAME:
+      msg = "Incomplete frame";
+      break;
+   case MP4AUDEC_LOST_FRAME_SYNC:
+      msg = "Lost frame sync";
+      break;
+   }
 
-   channels = ((header[2] & 1) << 2) | (header[3] >> 6);
-   if (channels == 0 || channels >= ARRAY_SIZE(Channels))
-      ERROR_SET(err, unknown, "Invalid channel configuration");
+   error_set_unknown(err, msg);
+}
 
-   parsed.Channels = Channels[channels];
+void
+FreeDecoderMemory(char *p)
+{
+   delete [] p;
+}
 
-   parsed.SamplesPerFrame = 1024 * ((header[6] & 3) + 1);
+// Decoder memory is the same size for every decoder, ADTS or not, so a
+// new one can take what an old one left behind.
+//
+DecoderPool<char, FreeDecoderMemory> &
+GetDecoderMemoryPool(void)
+{
+   static auto pool = new DecoderPool<char, FreeDecoderMemory>();
+   return *pool;
+}
 
-   // XXX, the decoder seems to assume a stereo output buffer
-   // for mono files.
-   //
-   if (parsed.Channels == 1)
-      parsed.SamplesPerFrame *= 2;
+// Frame parser for SeekBase::SetDurationScan().
+//
+int
+GetFrameDuration(const unsigned char *p, int len, uint64_t &duration)
+{
+   AdtsHeader header;
 
-   parsed.FrameSize = 
-      (((uint32_t)(header[3] & 3)) << 11) |
-      (((uint32_t)header[4]) << 3) |
-      (header[5] >> 5);
+   if (len < HEADER_SIZE || !ParseAdtsHeader(p, header))
+      return 0;
 
-   if (parsed.FrameSize < HEADER_SIZE)
-      ERROR_SET(err, unknown, "ADTS frame too small");
-exit:;
+   duration = header.SamplesPerFrame * 10000000LL / header.SampleRate;
+   return header.FrameSize;
 }
 
 class AacSource : public Source, public SeekBase
@@ -101,33 +159,41 @@ class AacSource : public Source, public SeekBase
    void *pMem;
    tPVMP4AudioDecoderExternal decoderExt;
    Pointer<Stream> stream;
-   ParsedFrameHeader lastHeader;
+   AdtsHeader lastHeader;
+   CarryOver carryOver;
+   bool deferredMetadataChange;
+   bool decodedFirstFrame;
    bool eof;
    uint64_t startOfData;
    uint64_t currentPos;
    unsigned char readBuffer[8192];
+   std::vector<unsigned char> resyncWindow;
    char description[128];
 
 public:
 
-   AacSource(ParsedFrameHeader header, uint64_t duration) :
+   AacSource(AdtsHeader header, uint64_t duration) :
       SeekBase(duration),
       pMem(nullptr),
       lastHeader(header),
+      deferredMetadataChange(false),
+      decodedFirstFrame(false),
       eof(false),
       startOfData(0),
       currentPos(0)
    {
       ContainerHasSlowSeek = true;
 
-      pMem = new char[PVMP4AudioDecoderGetMemRequirements()];
+      pMem = GetDecoderMemoryPool().Get();
+      if (!pMem)
+         pMem = new char[PVMP4AudioDecoderGetMemRequirements()];
       memset(&decoderExt, 0, sizeof(decoderExt));
       PVMP4AudioDecoderInitLibrary(&decoderExt, pMem);
    }
 
    ~AacSource()
    {
-      delete [] (char*)pMem;
+      GetDecoderMemoryPool().Put((char*)pMem);
    }
 
    const char *Describe(void)
@@ -156,81 +222,115 @@ public:
    exit:;
    }
 
+   // See CodecArgs::FrameIndex.
+   //
+   void SetFrameIndex(const std::shared_ptr<FrameIndexSeekTable> &frameIndex, error *err)
+   {
+      SeekBase::SetFrameIndex(frameIndex, stream.Get(), startOfData, err);
+   }
+
+   // See CodecArgs::DurationStream.
+   //
+   void SetDurationStream(Stream *durationStream, error *err)
+   {
+      SetDurationScan(
+         durationStream, startOfData, HEADER_SIZE,
+         GetFrameDuration, &DurationRefined, err
+      );
+   }
+
    void GetMetadata(Metadata *metadata, error *err)
    {
       metadata->Format = PcmShort;
       metadata->Channels = lastHeader.Channels;
-      metadata->SampleRate = lastHeader.SampleRate;
-      metadata->SamplesPerFrame = lastHeader.SamplesPerFrame;
+      metadata->SampleRate = lastHeader.SampleRate * decoderExt.aacPlusUpsamplingFactor;
+      metadata->SamplesPerFrame = GetOutputSamples(lastHeader);
    }
 
    int Read(void *buf, int len, error *err)
    {
       int r = 0;
-      int32_t status = 0;
-      int retryCount = 5;
+      int n = 0;
 
-      if (!len || eof)
+      if (!carryOver.Empty())
+      {
+         r = carryOver.Drain(buf, len);
+         if (!carryOver.Empty())
+            goto exit;
+      }
+      if (deferredMetadataChange)
+      {
+         deferredMetadataChange = false;
+         MetadataChanged = true;
          goto exit;
+      }
 
-   retry:
-      if (len < (lastHeader.SamplesPerFrame
-                    * lastHeader.Channels
-                    * GetBitsPerSample(PcmShort)/8))
+      // Decode as many whole frames as fit in the caller's buffer.
+      // Not the first, which may come out at a new rate; see below.
+      //
+      while (decodedFirstFrame && !eof && !MetadataChanged && len >= GetFrameBytes())
       {
-         ERROR_SET(
-            err,
-            unknown,
-            "Codec wants entire frames. Buffer is too small."
-         );
+         n = DecodeFrame(buf, len, err);
+         ERROR_CHECK(err);
+         if (!n)
+            break;
+         buf = (char*)buf + n;
+         len -= n;
+         r += n;
       }
 
-      decoderExt.desiredChannels = lastHeader.Channels;
-      decoderExt.inputBufferUsedLength = 0;
-      decoderExt.inputBufferCurrentLength = HEADER_SIZE + stream->Read(
-         readBuffer + HEADER_SIZE,
-         lastHeader.FrameSize - HEADER_SIZE,
-         err
-      );
-      ERROR_CHECK(err);
-
-      decoderExt.pOutputBuffer = (Int16*)buf;
+      // Less than a frame of room, or the first frame, and nothing to
+      // return yet.  Decode into our own buffer and hand out what fits.
+      //
+      if (!r && len && !eof && !MetadataChanged)
+      {
+         auto frameBytes = GetFrameBytes();
+         auto upsampling = decoderExt.aacPlusUpsamplingFactor;
+         void *p = carryOver.Prepare(frameBytes, GetDuration(lastHeader), err);
+         ERROR_CHECK(err);
+         n = DecodeFrame(p, frameBytes, err);
+         ERROR_CHECK(err);
+         carryOver.SetLength(n);
 
-      status = PVMP4AudioDecodeFrame(&decoderExt, pMem);
-      if (status != MP4AUDEC_SUCCESS)
-         ERROR_SET(err, pvmp4, status);
+         // The decoder finds implicit SBR on the first frame, which
+         // then comes out at twice the sample rate.  Have the caller
+         // re-negotiate before handing any of it out.
+         //
+         if (!decodedFirstFrame)
+         {
+            decodedFirstFrame = true;
+            if (upsampling != decoderExt.aacPlusUpsamplingFactor)
+            {
+               MetadataChanged = true;
+               goto exit;
+            }
+         }
 
-      r = decoderExt.frameLength;
-      currentPos += SamplesToUnits(r, lastHeader.SampleRate);
-      r *= (GetBitsPerSample(PcmShort)/8) * lastHeader.Channels;
+         r = carryOver.Drain(buf, len);
 
-      ReadHeader(readBuffer, err);
-     
-      if (ERROR_FAILED(err)) { eof = true; error_clear(err); }
-   exit:
-      if (status)
-      {
-         if (retryCount--)
+         // Don't let the caller re-negotiate while there are still
+         // samples in the old format to give out.
+         //
+         if (MetadataChanged && !carryOver.Empty())
          {
-            error_clear(err);
-            status = 0;
-            SkipFrame(err);
-            if (!ERROR_FAILED(err) && !MetadataChanged)
-               goto retry;
+            MetadataChanged = false;
+            deferredMetadataChange = true;
          }
-         if (ERROR_FAILED(err)) { eof = true; error_clear(err); }
       }
+   exit:
       return r;
    }
 
    void Seek(uint64_t pos, error *err)
    {
+      carryOver.Clear();
+      deferredMetadataChange = false;
       SeekBase::Seek(pos, err);
    }
 
    uint64_t GetPosition(error *err)
    {
-      return GetPosition();
+      return GetPosition() - carryOver.GetRemainingDuration();
    }
 
    uint64_t GetDuration(error *err) 
@@ -252,6 +352,62 @@ public:
 
 private:
 
+   int GetFrameBytes(void)
+   {
+      return GetOutputSamples(lastHeader)
+             * lastHeader.Channels
+             * GetBitsPerSample(PcmShort)/8;
+   }
+
+   // Decode one frame into @buf, which must have room for it.
+   //
+   int DecodeFrame(void *buf, int len, error *err)
+   {
+      int r = 0;
+      int32_t status = 0;
+      int retryCount = 5;
+
+   retry:
+      decoderExt.desiredChannels = lastHeader.Channels;
+      decoderExt.inputBufferUsedLength = 0;
+      decoderExt.inputBufferCurrentLength = HEADER_SIZE + stream->Read(
+         readBuffer + HEADER_SIZE,
+         lastHeader.FrameSize - HEADER_SIZE,
+         err
+      );
+      ERROR_CHECK(err);
+
+      SetOutputBuffer(decoderExt, buf);
+
+      status = PVMP4AudioDecodeFrame(&decoderExt, pMem);
+      if (status != MP4AUDEC_SUCCESS)
+         ERROR_SET(err, pvmp4, status);
+
+      // SBR doubles the samples and the rate, so go by the core.
+      //
+      currentPos += SamplesToUnits(decoderExt.frameLength, lastHeader.SampleRate);
+      r = GetDecodedSamples(decoderExt);
+      r *= (GetBitsPerSample(PcmShort)/8) * lastHeader.Channels;
+
+      ReadHeader(readBuffer, err);
+     
+      if (ERROR_FAILED(err)) { eof = true; error_clear(err); }
+   exit:
+      if (status)
+      {
+         if (retryCount--)
+         {
+            error_clear(err);
+            status = 0;
+            SkipFrame(err);
+            if (!ERROR_FAILED(err) && !MetadataChanged)
+               goto retry;
+         }
+         if (ERROR_FAILED(err)) { eof = true; error_clear(err); }
+      }
+      return r;
+   }
+
    void ReadHeader(void *buf, error *err)
    {
       unsigned char header[HEADER_SIZE];
@@ -263,14 +419,26 @@ private:
 
       r = stream->Read(p, sizeof(header), err);
       ERROR_CHECK(err);
-      if (r != sizeof(header) || !IsSyncWord(p))
+      if (r != sizeof(header))
       {
          eof = true;
          goto exit;
       }
 
       ParseHeader(p, lastHeader, err);
-      ERROR_CHECK(err);
+      if (ERROR_FAILED(err))
+      {
+         error_clear(err);
+         if (!ResyncStream(stream.Get(), resyncWindow, 0xf0, sizeof(header),
+                           GetFrameLength, p, err))
+         {
+            ERROR_CHECK(err);
+            eof = true;
+            goto exit;
+         }
+         ParseHeader(p, lastHeader, err);
+         ERROR_CHECK(err);
+      }
       if (channels != lastHeader.Channels ||
           sampleRate != lastHeader.SampleRate ||
           samplesPerFrame != lastHeader.SamplesPerFrame)
@@ -288,32 +456,11 @@ private:
    }
 
    uint64_t
-   GetDuration(const ParsedFrameHeader &header)
+   GetDuration(const AdtsHeader &header)
    {
       return SamplesToUnits(header.SamplesPerFrame, header.SampleRate);
    }
 
-   void
-   error_set_pvmp4(error *err, int32_t code)
-   {
-      const char *msg = "frame decode error";
-
-      switch (code)
-      {
-      case MP4AUDEC_INVALID_FRAME:
-         msg = "Invalid frame";
-         break;
-      case MP4AUDEC_INCOMPLETE_FRAME:
-         msg = "Incomplete frame";
-         break;
-      case MP4AUDEC_LOST_FRAME_SYNC:
-         msg = "Lost frame sync";
-         break;
-      }
-
-      error_set_unknown(err, msg);
-   }
-
 protected:
 
    //
@@ -362,6 +509,31 @@ protected:
    exit:;
    }
 
+   bool GetFrameOffset(uint64_t &off, error *err)
+   {
+      if (eof)
+         return false;
+
+      // The header has already been consumed.
+      //
+      off = stream->GetPosition(err) - HEADER_SIZE - startOfData;
+      return !ERROR_FAILED(err);
+   }
+
+   bool GetFrameParser(
+      Stream **stream,
+      uint64_t &base,
+      int &headerBytes,
+      FrameParser &parse
+   )
+   {
+      *stream = this->stream.Get();
+      base = startOfData;
+      headerBytes = HEADER_SIZE;
+      parse = GetFrameDuration;
+      return true;
+   }
+
    void CapturePosition(RollbackBase **rollback, error *err)
    {
       *rollback = CreateRollbackWithCursorPos(
@@ -373,6 +545,128 @@ protected:
    }
 };
 
+//
+// For AAC out of a container that gives us raw frames with their
+// AudioSpecificConfig, rather than ADTS.
+//
+class AacMicroCodec : public MicroCodec
+{
+   void *pMem;
+   tPVMP4AudioDecoderExternal decoderExt;
+   AdtsHeader config;
+   char description[128];
+
+public:
+
+   AacMicroCodec() : pMem(nullptr)
+   {
+      pMem = GetDecoderMemoryPool().Get();
+      if (!pMem)
+         pMem = new char[PVMP4AudioDecoderGetMemRequirements()];
+      memset(&decoderExt, 0, sizeof(decoderExt));
+      memset(&config, 0, sizeof(config));
+      PVMP4AudioDecoderInitLibrary(&decoderExt, pMem);
+   }
+
+   ~AacMicroCodec()
+   {
+      GetDecoderMemoryPool().Put((char*)pMem);
+   }
+
+   void
+   Initialize(const void *buf, int nbytes, error *err)
+   {
+      const unsigned char *p = (const unsigned char *)buf;
+      int objectType = 0, freq = 0, channels = 0;
+      int32_t status = 0;
+
+      if (nbytes < 2)
+         ERROR_SET(err, unknown, "AudioSpecificConfig too short");
+
+      objectType = (p[0] >> 3);
+      freq = ((p[0] & 0x7) << 1) | (p[1] >> 7);
+      channels = (p[1] & 0x7f) >> 3;
+
+      if (!objectType || objectType >= 4)
+         ERROR_SET(err, unknown, "Object type not supported");
+      if (freq >= ARRAY_SIZE(AacSampleRates))
+         ERROR_SET(err, unknown, "Sample rate not supported");
+      if (!channels || channels >= ARRAY_SIZE(AacChannels))
+         ERROR_SET(err, unknown, "Channel configuration not supported");
+
+      config.MpegVersion = 4;
+      config.SampleRate = AacSampleRates[freq];
+      config.Channels = AacChannels[channels];
+      config.SamplesPerFrame = 1024;
+
+      decoderExt.pInputBuffer = (UChar*)p;
+      decoderExt.inputBufferMaxLength = nbytes;
+      decoderExt.inputBufferCurrentLength = nbytes;
+      decoderExt.inputBufferUsedLength = 0;
+      decoderExt.outputFormat = OUTPUTFORMAT_16PCM_INTERLEAVED;
+      decoderExt.repositionFlag = decoderExt.aacPlusEnabled = TRUE;
+
+      status = PVMP4AudioDecoderConfig(&decoderExt, pMem);
+      if (status != MP4AUDEC_SUCCESS)
+         ERROR_SET(err, pvmp4, status);
+   exit:;
+   }
+
+   const char *
+   Describe(void)
+   {
+      snprintf(
+         description,
+         sizeof(description),
+         "[opencore] AAC, MPEG-%d",
+         config.MpegVersion
+      );
+      return description;
+   }
+
+   void
+   GetMetadata(Metadata *metadata, error *err)
+   {
+      metadata->Format = PcmShort;
+      metadata->Channels = config.Channels;
+      metadata->SampleRate = config.SampleRate * decoderExt.aacPlusUpsamplingFactor;
+      metadata->SamplesPerFrame = GetOutputSamples(config);
+   }
+
+   int
+   Decode(
+      const void *samples,
+      int samplesNBytes,
+      void *outputBuffer,
+      int outputBufferNBytes,
+      error *err
+   )
+   {
+      int r = 0;
+      int32_t status = 0;
+      int bytesPerSample = GetBitsPerSample(PcmShort) / 8;
+
+      if (outputBufferNBytes < GetOutputSamples(config) * config.Channels * bytesPerSample)
+         ERROR_SET(err, unknown, "Output buffer too small");
+
+      decoderExt.pInputBuffer = (UChar*)samples;
+      decoderExt.inputBufferMaxLength = samplesNBytes;
+      decoderExt.inputBufferCurrentLength = samplesNBytes;
+      decoderExt.inputBufferUsedLength = 0;
+      decoderExt.remainderBits = 0;
+      decoderExt.desiredChannels = config.Channels;
+      SetOutputBuffer(decoderExt, outputBuffer);
+
+      status = PVMP4AudioDecodeFrame(&decoderExt, pMem);
+      if (status != MP4AUDEC_SUCCESS)
+         ERROR_SET(err, pvmp4, status);
+
+      r = GetDecodedSamples(decoderExt) * bytesPerSample * config.Channels;
+   exit:
+      return r;
+   }
+};
+
 struct AacCodec : public Codec
 {
    void TryOpen(
@@ -384,53 +678,43 @@ struct AacCodec : public Codec
       error *err
    )
    {
-      ParsedFrameHeader header;
+      AdtsHeader header;
       Pointer<AacSource> r;
       const unsigned char *p = (const unsigned char *)firstBuffer;
       bool headerParsed = false;
 
       if (firstBufferSize >= HEADER_SIZE)
       {
-         if (IsSyncWord(p))
+         // Try parsing this one.
+         //
+         if (ParseAdtsHeader(p, header))
          {
-            // Try parsing this one.
-            //
-            ParseHeader(p, header, err);
+            unsigned char nextHeader[HEADER_SIZE];
+            AdtsHeader next;
 
             // Make sure the next one parses.
             // Eliminates false positives above.
             //
-            if (!ERROR_FAILED(err))
+            auto offsetToNext = header.FrameSize;
+            if (offsetToNext + HEADER_SIZE <= firstBufferSize)
             {
-               unsigned char nextHeader[HEADER_SIZE];
-               ParsedFrameHeader next;
-
-               auto offsetToNext = header.FrameSize;
-               if (offsetToNext + HEADER_SIZE <= firstBufferSize)
-               {
-                  memcpy(nextHeader, p + offsetToNext, HEADER_SIZE);
-               }
-               else
+               memcpy(nextHeader, p + offsetToNext, HEADER_SIZE);
+            }
+            else
+            {
+               uint64_t oldPos = file->GetPosition(err);
+               ERROR_CHECK(err);
+               file->Seek(offsetToNext, SEEK_CUR, err);
+               ERROR_CHECK(err);
+               if (HEADER_SIZE != file->Read(nextHeader, HEADER_SIZE, err))
                {
-                  uint64_t oldPos = file->GetPosition(err);
-                  ERROR_CHECK(err);
-                  file->Seek(offsetToNext, SEEK_CUR, err);
-                  ERROR_CHECK(err);
-                  if (HEADER_SIZE != file->Read(nextHeader, HEADER_SIZE, err))
-                  {
-                     ERROR_CHECK(err);
-                     ERROR_SET(err, unknown, "short read");
-                  }
-                  file->Seek(oldPos, SEEK_SET, err);
                   ERROR_CHECK(err);
+                  ERROR_SET(err, unknown, "short read");
                }
-               ParseHeader(nextHeader, next, err);
+               file->Seek(oldPos, SEEK_SET, err);
+               ERROR_CHECK(err);
             }
-            if (!ERROR_FAILED(err))
-            {
-               headerParsed = true;
-            }
-            error_clear(err);
+            headerParsed = ParseAdtsHeader(nextHeader, next);
          }
       }
 
@@ -449,6 +733,12 @@ struct AacCodec : public Codec
       r->Initialize(file, err);
       ERROR_CHECK(err);
 
+      r->SetFrameIndex(params.FrameIndex, err);
+      ERROR_CHECK(err);
+
+      r->SetDurationStream(params.DurationStream.Get(), err);
+      ERROR_CHECK(err);
+
    exit:
       if (ERROR_FAILED(err)) r = nullptr;
       *obj = r.Detach();
@@ -469,3 +759,13 @@ exit:
    *codec = p.Detach();
 }
 
+void audio::CreateOpenCoreAacMicroCodec(MicroCodec **codec, error *err)
+{
+   Pointer<AacMicroCodec> p;
+   New(p.GetAddressOf(), err);
+   ERROR_CHECK(err);
+exit:
+   if (ERROR_FAILED(err))
+      p = nullptr;
+   *codec = p.Detach();
+}
@@ -45,6 +45,27 @@ class AmrSource : public Source, public SeekBase
       return (samples * 10000000LL / sampleRate);
    }
 
+   // Reads frame headers without touching the source, so that it can
+   // be used from another thread.
+   //
+   FrameParser
+   MakeFrameParser(void)
+   {
+      const int *sizes = sizeTable;
+      int nSizes = sizeTableLen;
+
+      return [sizes, nSizes] (const unsigned char *p, int len, uint64_t &duration) -> int
+      {
+         int cmr = ((p[0] >> 3) & 0x0f);
+
+         if (cmr >= nSizes)
+            return 0;
+
+         duration = 20 * 10000000LL / 1000;
+         return 1 + sizes[cmr];
+      };
+   }
+
    void
    ReadFrame(error *err)
    {
@@ -105,6 +126,23 @@ public:
    virtual void Initialize(error *err)
    {
       startOfData = stream->GetPosition(err);
+      ERROR_CHECK(err);
+
+      // Read() decodes the frame that's already in readBuffer.
+      //
+      ReadFrame(err);
+      ERROR_CHECK(err);
+   exit:;
+   }
+
+   // See CodecArgs::DurationStream.
+   //
+   void SetDurationStream(Stream *durationStream, error *err)
+   {
+      SetDurationScan(
+         durationStream, startOfData, 1,
+         MakeFrameParser(), &DurationRefined, err
+      );
    }
 
    void GetMetadata(Metadata *metadata, error *err)
@@ -205,6 +243,31 @@ protected:
    exit:;
    }
 
+   bool GetFrameOffset(uint64_t &off, error *err)
+   {
+      if (eof)
+         return false;
+
+      // The whole frame has already been read.
+      //
+      off = stream->GetPosition(err) - 1 - sizeTable[(readBuffer[0] >> 3) & 0x0f] - startOfData;
+      return !ERROR_FAILED(err);
+   }
+
+   bool GetFrameParser(
+      Stream **stream,
+      uint64_t &base,
+      int &headerBytes,
+      FrameParser &parse
+   )
+   {
+      *stream = this->stream.Get();
+      base = startOfData;
+      headerBytes = 1;
+      parse = MakeFrameParser();
+      return true;
+   }
+
    void CapturePosition(RollbackBase **rollback, error *err)
    {
       *rollback = CreateRollbackWithCursorPos(
@@ -324,6 +387,7 @@ struct AmrCodec : public Codec
 {
    const int MagicLen = 9;
    int GetBytesRequiredForDetection() { return MagicLen; }
+   FileType GetFileType() { return FileTypeAmr; }
 
    void TryOpen(
       common::Stream *file,
@@ -365,6 +429,9 @@ struct AmrCodec : public Codec
       r->Initialize(err);
       ERROR_CHECK(err);
 
+      r->SetDurationStream(params.DurationStream.Get(), err);
+      ERROR_CHECK(err);
+
    exit:
       if (ERROR_FAILED(err)) r = nullptr;
       *obj = r.Detach();
@@ -16,6 +16,10 @@
 #include "../../third_party/opencore-audio/mp3/dec/src/pvmp3_framedecoder.h"
 
 #include "seekbase.h"
+#include "carryover.h"
+#include "decoderpool.h"
+#include "mpegheader.h"
+#include "syncscan.h"
 
 #include <string.h>
 #include <errno.h>
@@ -27,143 +31,61 @@ using namespace audio;
 
 namespace {
 
-struct ParsedFrameHeader
-{
-   int MpegVersion;
-   bool Mpeg25;
-   int Layer;
-   int Bitrate;
-   int SampleRate;
-   int Channels;
-   int Padding;
-   bool Protection;
-   int FrameSize;
-   int SamplesPerFrame;
-};
-
-bool IsSyncWord(const unsigned char *p)
-{
-   return (p[0] == 0xff) && ((p[1] & 0xe0) == 0xe0);
-}
-
 void ParseHeader(
    const unsigned char header[4],
-   ParsedFrameHeader& parsed,
+   MpegAudioHeader& parsed,
    error *err
 )
 {
-   memset(&parsed, 0, sizeof(parsed));
-
-   static const int bitrates[] =
-   {
-      // mpeg1, layer I
-      32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448,
-      // mpeg1, layer II
-      32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384, 
-      // mpeg1, layer III
-      32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 
-      // mpeg2, layer I
-      32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256,
-      // mpeg2, layer II
-      8,  16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160,
-      // mpeg2, layer III
-      8,  16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160,
-   };
-   static const int sampleRates[] =
-   {
-      // mpeg1
-      44100, 48000, 32000,
-      // mpeg2
-      22050, 24000, 16000,
-      // mpeg2.5
-      11025, 12000,  8000,
-   };
-   static const int samplesPerFrame[] =
-   {
-      // mpeg1:
-      // layer 1
-      384,
-      // layer 2
-      1152,
-      // layer 3
-      1152,
-      // mpeg 2:
-      // layer 1
-      384,
-      // layer 2
-      1152,
-      // layer 3
-      576,
-   };
-   unsigned char layer = 0, bitrate = 0, sampleRate = 0;
-
-   if (!IsSyncWord(header))
-      ERROR_SET(err, unknown, "Bad frame header - no sync word");
-
-   parsed.MpegVersion = 4 - ((header[1] >> 3) & 3);
-   parsed.Mpeg25 = ((header[1]&0xf0) == 0xe0);
-   if (parsed.Mpeg25)
-   {
-      if (parsed.MpegVersion != 4)
-         ERROR_SET(err, unknown, "Invalid MPEG version");
-      parsed.MpegVersion = 2;
-   }
-   if (parsed.MpegVersion < 1 || parsed.MpegVersion > 2)
-      ERROR_SET(err, unknown, "Invalid MPEG version");
-
-   parsed.Protection = !(header[1]&1);
-
-   layer = (header[1] >> 1) & 0x3;
-   switch (layer)
-   {
-   case 1:
-      parsed.Layer = 3;
-      break;
-   case 2:
-      parsed.Layer = 2;
-      break;
-   case 3:
-      parsed.Layer = 1;
-      break;
-   default:
-      ERROR_SET(err, unknown, "Invalid layer");
-   }
-
-   if (parsed.Mpeg25 && parsed.Layer != 3)
-      ERROR_SET(err, unknown, "Invalid layer for MPEG-2.5");
-
-   bitrate = (header[2] >> 4);
-   if (!bitrate || bitrate == 0xf)
-      ERROR_SET(err, unknown, "Invalid bitrate");
+   if (!ParseMpegAudioHeader(header, parsed))
+      ERROR_SET(err, unknown, "Bad MPEG audio frame header");
+exit:;
+}
 
-   parsed.Bitrate = 
-      (bitrates + (ARRAY_SIZE(bitrates)/2) * (parsed.MpegVersion-1)
-                + (ARRAY_SIZE(bitrates)/6) * (parsed.Layer - 1))[bitrate - 1];
+// Frame length callback for FindFrameRun() and ResyncStream().
+//
+int
+GetFrameLength(const unsigned char *p, int len, unsigned &key)
+{
+   MpegAudioHeader header;
 
-   sampleRate = (header[2] >> 2) & 0x3;
-   if (sampleRate == 3)
-      ERROR_SET(err, unknown, "Invalid sample rate");
+   if (len < 4 || !ParseMpegAudioHeader(p, header))
+      return 0;
 
-   parsed.SampleRate =
-      (sampleRates + ARRAY_SIZE(sampleRates)/3
-                   * (parsed.MpegVersion-1 + (parsed.Mpeg25 ? 1 : 0)))
-         [sampleRate];
+   // Version, layer and sample rate shouldn't change mid-stream.
+   //
+   key = header.Key;
+   return header.FrameSize;
+}
 
-   parsed.Padding = ((header[2] >> 1) & 1);
+void
+FreeDecoderMemory(char *p)
+{
+   delete [] p;
+}
 
-   parsed.Channels = ((header[3] >> 6) == 3) ? 1 : 2;
+// Decoder memory is the same size for every source, so a new one can
+// take what an old one left behind.
+//
+DecoderPool<char, FreeDecoderMemory> &
+GetDecoderMemoryPool(void)
+{
+   static auto pool = new DecoderPool<char, FreeDecoderMemory>();
+   return *pool;
+}
 
-   parsed.SamplesPerFrame =
-      (samplesPerFrame + ARRAY_SIZE(samplesPerFrame)/2
-                       * (parsed.MpegVersion-1))
-         [parsed.Layer - 1];
+// Frame parser for SeekBase::SetDurationScan().
+//
+int
+GetFrameDuration(const unsigned char *p, int len, uint64_t &duration)
+{
+   MpegAudioHeader header;
 
-   parsed.FrameSize = parsed.SamplesPerFrame/8 * 1000
-                         * parsed.Bitrate / parsed.SampleRate;
+   if (len < 4 || !ParseMpegAudioHeader(p, header))
+      return 0;
 
-   if (parsed.FrameSize + parsed.Padding < 4)
-      ERROR_SET(err, unknown, "ADTS frame too small");
-exit:;
+   duration = header.SamplesPerFrame * 10000000LL / header.SampleRate;
+   return header.FrameSize;
 }
 
 class Mp3Source : public Source, public SeekBase
@@ -171,33 +93,41 @@ class Mp3Source : public Source, public SeekBase
    void *pMem;
    tPVMP3DecoderExternal decoderExt;
    Pointer<Stream> stream;
-   ParsedFrameHeader lastHeader;
+   MpegAudioHeader lastHeader;
+   Format format;
+   CarryOver carryOver;
+   bool deferredMetadataChange;
    bool eof;
    uint64_t startOfData;
    uint64_t currentPos;
    unsigned char readBuffer[4096];
+   std::vector<unsigned char> resyncWindow;
    char description[128];
 
 public:
 
-   Mp3Source(ParsedFrameHeader header, uint64_t duration) :
+   Mp3Source(MpegAudioHeader header, uint64_t duration) :
       SeekBase(duration),
       pMem(nullptr),
       lastHeader(header),
+      format(PcmShort),
+      deferredMetadataChange(false),
       eof(false),
       startOfData(0),
       currentPos(0)
    {
       ContainerHasSlowSeek = true;
 
-      pMem = new char[pvmp3_decoderMemRequirements()];
+      pMem = GetDecoderMemoryPool().Get();
+      if (!pMem)
+         pMem = new char[pvmp3_decoderMemRequirements()];
       memset(&decoderExt, 0, sizeof(decoderExt));
       pvmp3_InitDecoder(&decoderExt, pMem);
    }
 
    ~Mp3Source()
    {
-      delete [] (char*)pMem;
+      GetDecoderMemoryPool().Put((char*)pMem);
    }
 
    const char *Describe(void)
@@ -227,45 +157,152 @@ public:
    exit:;
    }
 
+   // See CodecArgs::FrameIndex.
+   //
+   void SetFrameIndex(const std::shared_ptr<FrameIndexSeekTable> &frameIndex, error *err)
+   {
+      SeekBase::SetFrameIndex(frameIndex, stream.Get(), startOfData, err);
+   }
+
+   // See CodecArgs::DurationStream.
+   //
+   void SetDurationStream(Stream *durationStream, error *err)
+   {
+      SetDurationScan(
+         durationStream, startOfData, 4,
+         GetFrameDuration, &DurationRefined, err
+      );
+   }
+
    void GetMetadata(Metadata *metadata, error *err)
    {
-      metadata->Format = PcmShort;
+      metadata->Format = format;
       metadata->Channels = lastHeader.Channels;
       metadata->SampleRate = lastHeader.SampleRate;
       metadata->SamplesPerFrame = lastHeader.SamplesPerFrame;
    }
 
+   bool SetFormat(Format format, error *err)
+   {
+      switch (format)
+      {
+      case PcmShort:
+      case PcmFloat:
+         // The synthesis filter can write either one directly.
+         //
+         if (this->format != format)
+            carryOver.Clear();
+         this->format = format;
+         return true;
+      default:
+         return false;
+      }
+   }
+
    int Read(void *buf, int len, error *err)
    {
       int r = 0;
-      int32_t status = 0;
-      int retryCount = 5;
+      int n = 0;
 
-      if (!len || eof)
+      if (!carryOver.Empty())
+      {
+         r = carryOver.Drain(buf, len);
+         if (!carryOver.Empty())
+            goto exit;
+      }
+      if (deferredMetadataChange)
+      {
+         deferredMetadataChange = false;
+         MetadataChanged = true;
          goto exit;
+      }
 
-   retry:
-      if (len < (lastHeader.SamplesPerFrame
-                    * lastHeader.Channels
-                    * GetBitsPerSample(PcmShort)/8))
+      // Decode as many whole frames as fit in the caller's buffer.
+      //
+      while (!eof && !MetadataChanged && len >= GetFrameBytes())
       {
-         ERROR_SET(
-            err,
-            unknown,
-            "Codec wants entire frames. Buffer is too small."
-         );
+         n = DecodeFrame(buf, len, err);
+         ERROR_CHECK(err);
+         if (!n)
+            break;
+         buf = (char*)buf + n;
+         len -= n;
+         r += n;
+      }
+
+      // Less than a frame of room, and nothing to return yet.
+      // Decode into our own buffer and hand out what fits.
+      //
+      if (!r && len && !eof && !MetadataChanged)
+      {
+         auto frameBytes = GetFrameBytes();
+         void *p = carryOver.Prepare(frameBytes, GetDuration(lastHeader), err);
+         ERROR_CHECK(err);
+         n = DecodeFrame(p, frameBytes, err);
+         ERROR_CHECK(err);
+         carryOver.SetLength(n);
+         r = carryOver.Drain(buf, len);
+
+         // Don't let the caller re-negotiate while there are still
+         // samples in the old format to give out.
+         //
+         if (MetadataChanged && !carryOver.Empty())
+         {
+            MetadataChanged = false;
+            deferredMetadataChange = true;
+         }
       }
+   exit:
+      return r;
+   }
 
+   void Seek(uint64_t pos, error *err)
+   {
+      carryOver.Clear();
+      deferredMetadataChange = false;
+      SeekBase::Seek(pos, err);
+   }
+
+   uint64_t GetPosition(error *err)
+   {
+      return GetPosition() - carryOver.GetRemainingDuration();
+   }
+
+   uint64_t GetDuration(error *err) 
+   {
+      return SeekBase::GetDuration(err);
+   }
+
+private:
+
+   int GetFrameBytes(void)
+   {
+      return lastHeader.SamplesPerFrame
+             * lastHeader.Channels
+             * GetBitsPerSample(format)/8;
+   }
+
+   // Decode one frame into @buf, which must have room for it.
+   //
+   int DecodeFrame(void *buf, int len, error *err)
+   {
+      int r = 0;
+      int32_t status = 0;
+      int retryCount = 5;
+      int sampleSize = GetBitsPerSample(format)/8;
+
+   retry:
       decoderExt.inputBufferUsedLength = 0;
       decoderExt.inputBufferCurrentLength = 4 + stream->Read(
          readBuffer + 4, 
-         lastHeader.FrameSize + lastHeader.Padding - 4,
+         lastHeader.FrameSize - 4,
          err
       );
       ERROR_CHECK(err);
 
       decoderExt.pOutputBuffer = (int16*)buf;
-      decoderExt.outputFrameSize = len/(2 * lastHeader.Channels);
+      decoderExt.pOutputBufferFloat = (format == PcmFloat) ? (float*)buf : nullptr;
+      decoderExt.outputFrameSize = len/(sampleSize * lastHeader.Channels);
 
       status = pvmp3_framedecoder(&decoderExt, pMem);
       if (status != NO_DECODING_ERROR)
@@ -273,7 +310,7 @@ public:
 
       r = decoderExt.outputFrameSize;
       currentPos += SamplesToUnits(r, lastHeader.SampleRate);
-      r *= 2 * lastHeader.Channels;
+      r *= sampleSize * lastHeader.Channels;
 
       ReadHeader(readBuffer, err);
       if (ERROR_FAILED(err)) { eof = true; error_clear(err); }
@@ -293,23 +330,6 @@ public:
       return r;
    }
 
-   void Seek(uint64_t pos, error *err)
-   {
-      SeekBase::Seek(pos, err);
-   }
-
-   uint64_t GetPosition(error *err)
-   {
-      return GetPosition();
-   }
-
-   uint64_t GetDuration(error *err) 
-   {
-      return SeekBase::GetDuration(err);
-   }
-
-private:
-
    void ReadHeader(void *buf, error *err)
    {
       unsigned char header[4];
@@ -326,50 +346,19 @@ private:
          eof = true;
          goto exit;
       }
-      if (!IsSyncWord(p))
+      ParseHeader(p, lastHeader, err);
+      if (ERROR_FAILED(err))
       {
-rescan:
-         unsigned char scanBuffer[4096];
-         int nBytes;
-         bool match = false;
-
-         stream->Seek(0-sizeof(header), SEEK_CUR, err);
-         ERROR_CHECK(err);
-
-         nBytes = stream->Read(scanBuffer, sizeof(scanBuffer), err);
-         ERROR_CHECK(err);
-         if (nBytes < 4)
-         {
-            eof = true;
-            goto exit;
-         }
-
-         for (int i=0; i<nBytes-4; ++i)
-         {
-            if (IsSyncWord(scanBuffer + i))
-            {
-               stream->Seek(0-(nBytes - i - 4), SEEK_CUR, err);
-               ERROR_CHECK(err);
-               memcpy(p, scanBuffer+i, 4);
-               match = true;
-               break;
-            }
-         }
-
-         if (!match)
+         error_clear(err);
+         if (!ResyncStream(stream.Get(), resyncWindow, 0xe0, sizeof(header),
+                           GetFrameLength, p, err))
          {
+            ERROR_CHECK(err);
             eof = true;
             goto exit;
          }
-      }
-
-      ParseHeader(p, lastHeader, err);
-      if (ERROR_FAILED(err))
-      {
-         error_clear(err);
-         stream->Seek(1, SEEK_CUR, err);
+         ParseHeader(p, lastHeader, err);
          ERROR_CHECK(err);
-         goto rescan;
       }
       if (channels != lastHeader.Channels ||
           sampleRate != lastHeader.SampleRate ||
@@ -388,7 +377,7 @@ rescan:
    }
 
    uint64_t
-   GetDuration(const ParsedFrameHeader &header)
+   GetDuration(const MpegAudioHeader &header)
    {
       return SamplesToUnits(header.SamplesPerFrame, header.SampleRate);
    }
@@ -484,7 +473,7 @@ protected:
       if (!eof)
       {
          stream->Seek(
-            lastHeader.FrameSize + lastHeader.Padding - 4,
+            lastHeader.FrameSize - 4,
             SEEK_CUR,
             err
          );
@@ -498,6 +487,31 @@ protected:
    exit:;
    }
 
+   bool GetFrameOffset(uint64_t &off, error *err)
+   {
+      if (eof)
+         return false;
+
+      // The header has already been consumed.
+      //
+      off = stream->GetPosition(err) - 4 - startOfData;
+      return !ERROR_FAILED(err);
+   }
+
+   bool GetFrameParser(
+      Stream **stream,
+      uint64_t &base,
+      int &headerBytes,
+      FrameParser &parse
+   )
+   {
+      *stream = this->stream.Get();
+      base = startOfData;
+      headerBytes = 4;
+      parse = GetFrameDuration;
+      return true;
+   }
+
    void CapturePosition(RollbackBase **rollback, error *err)
    {
       *rollback = CreateRollbackWithCursorPos(
@@ -985,7 +999,7 @@ struct Mp3Codec : public Codec
       error *err
    )
    {
-      ParsedFrameHeader header;
+      MpegAudioHeader header;
       Pointer<Mp3Source> r;
       const unsigned char *p = (const unsigned char *)firstBuffer;
       bool headerParsed = false;
@@ -993,96 +1007,90 @@ struct Mp3Codec : public Codec
 
       if (firstBufferSize >= 4)
       {
-         if (IsSyncWord(p))
+         // Try parsing this one.
+         //
+         if (ParseMpegAudioHeader(p, header))
          {
-            // Try parsing this one.
-            //
-            ParseHeader(p, header, err);
-
             // We want to inspect the first frame for VBR headers.
             // We also want to make sure the next frame parses, to
             // eliminate false positives in the scanning process.
             //
-            if (!ERROR_FAILED(err))
+            auto offsetToNext = header.FrameSize;
+            const unsigned char *firstFrame = nullptr;
+            MpegAudioHeader next;
+
+            if (offsetToNext + 4 > firstBufferSize)
+            {
+               onHeap = new(std::nothrow) unsigned char[offsetToNext + 4];
+               if (!onHeap)
+                  ERROR_SET(err, nomem);
+               memcpy(onHeap, firstBuffer, firstBufferSize);
+               uint64_t oldPos = file->GetPosition(err);
+               ERROR_CHECK(err);
+               file->Seek(firstBufferSize, SEEK_CUR, err);
+               ERROR_CHECK(err);
+               auto r = file->Read(onHeap + firstBufferSize, offsetToNext+4-firstBufferSize, err);
+               ERROR_CHECK(err);
+               if (r != offsetToNext+4-firstBufferSize)
+                  ERROR_SET(err, unknown, "short read");
+               file->Seek(oldPos, SEEK_SET, err);
+               ERROR_CHECK(err);
+               firstFrame = onHeap;
+            }
+            else
+            {
+               firstFrame = (const unsigned char*)firstBuffer;
+            }
+
+            ParseHeader(firstFrame + offsetToNext, next, err);
+            ERROR_CHECK(err);
+
+            headerParsed = true;
+
+            VbrHeader vbrHeader(firstFrame+4, offsetToNext - 4);
+            if (vbrHeader.Scan())
             {
-               auto offsetToNext = header.FrameSize + header.Padding;
-               const unsigned char *firstFrame = nullptr;
-               ParsedFrameHeader next;
+               uint32_t frameCount = 0;
+               char desc[512];
+
+               vbrHeader.Describe(desc, sizeof(desc), err);
+               ERROR_CHECK(err);
+               log_printf("Found VBR Header: %s", desc);
 
-               if (offsetToNext + 4 > firstBufferSize)
+               if (!params.Duration && vbrHeader.GetFrameCount(frameCount) && header.SampleRate)
                {
-                  onHeap = new(std::nothrow) unsigned char[offsetToNext + 4];
-                  if (!onHeap)
-                     ERROR_SET(err, nomem);
-                  memcpy(onHeap, firstBuffer, firstBufferSize);
-                  uint64_t oldPos = file->GetPosition(err);
-                  ERROR_CHECK(err);
-                  file->Seek(firstBufferSize, SEEK_CUR, err);
-                  ERROR_CHECK(err);
-                  auto r = file->Read(onHeap + firstBufferSize, offsetToNext+4-firstBufferSize, err);
-                  ERROR_CHECK(err);
-                  if (r != offsetToNext+4-firstBufferSize)
-                     ERROR_SET(err, unknown, "short read");
-                  file->Seek(oldPos, SEEK_SET, err);
-                  ERROR_CHECK(err);
-                  firstFrame = onHeap;
+                  params.Duration = (header.SamplesPerFrame * 10000000LL) * frameCount / header.SampleRate;
                }
-               else
+
+               if (!params.SeekTable.get() && params.Duration)
                {
-                  firstFrame = (const unsigned char*)firstBuffer;
+                  auto dataStart = 0; /* was: offsetToNext */
+                  vbrHeader.CreateSeekTable(dataStart, params.Duration, file, params.SeekTable, err);
+                  ERROR_CHECK(err);
                }
 
-               ParseHeader(firstFrame + offsetToNext, next, err);
+               header = next;
+               file->Seek(offsetToNext, SEEK_CUR, err);
                ERROR_CHECK(err);
+            }
+            else
+            {
+               common::StreamInfo info;
 
-               headerParsed = true;
+               file->GetStreamInfo(&info, err);
+               ERROR_CHECK(err);
 
-               VbrHeader vbrHeader(firstFrame+4, offsetToNext - 4);
-               if (vbrHeader.Scan())
+               if (!params.SeekTable.get() && info.IsRemote)
                {
-                  uint32_t frameCount = 0;
-                  char desc[512];
-
-                  vbrHeader.Describe(desc, sizeof(desc), err);
-                  ERROR_CHECK(err);
-                  log_printf("Found VBR Header: %s", desc);
-
-                  if (!params.Duration && vbrHeader.GetFrameCount(frameCount) && header.SampleRate)
-                  {
-                     params.Duration = (header.SamplesPerFrame * 10000000LL) * frameCount / header.SampleRate;
-                  }
-
-                  if (!params.SeekTable.get() && params.Duration)
+                  try
                   {
-                     auto dataStart = 0; /* was: offsetToNext */
-                     vbrHeader.CreateSeekTable(dataStart, params.Duration, file, params.SeekTable, err);
-                     ERROR_CHECK(err);
+                     params.SeekTable = std::make_shared<CbrSeekTable>(file, header.Bitrate, params.Duration);
                   }
-
-                  header = next;
-                  file->Seek(offsetToNext, SEEK_CUR, err);
-                  ERROR_CHECK(err);
-               }
-               else
-               {
-                  common::StreamInfo info;
-
-                  file->GetStreamInfo(&info, err);
-                  ERROR_CHECK(err);
-
-                  if (!params.SeekTable.get() && info.IsRemote)
+                  catch (const std::bad_alloc&)
                   {
-                     try
-                     {
-                        params.SeekTable = std::make_shared<CbrSeekTable>(file, header.Bitrate, params.Duration);
-                     }
-                     catch (const std::bad_alloc&)
-                     {
-                        ERROR_SET(err, nomem);
-                     }
+                     ERROR_SET(err, nomem);
                   }
                }
-               error_clear(err);
             }
          }
       }
@@ -1104,6 +1112,11 @@ struct Mp3Codec : public Codec
 
       if (params.SeekTable.get())
          r->SetSeekTable(params.SeekTable);
+      r->SetFrameIndex(params.FrameIndex, err);
+      ERROR_CHECK(err);
+
+      r->SetDurationStream(params.DurationStream.Get(), err);
+      ERROR_CHECK(err);
 
    exit:
       if (onHeap)
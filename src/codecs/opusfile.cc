@@ -25,9 +25,10 @@ class OpusFile : public Source
 {
    Pointer<Stream> stream;
    OggOpusFile *file;
+   Format format;
 public:
    OpusFile(Stream *stream_) :
-      stream(stream_), file(nullptr)
+      stream(stream_), file(nullptr), format(PcmShort)
    {
    }
 
@@ -69,7 +70,7 @@ public:
    void
    GetMetadata(Metadata *res, error *err)
    {
-      res->Format = PcmShort;
+      res->Format = format;
       res->SampleRate = 48000;
       res->Channels = op_channel_count(file, -1);
       res->SamplesPerFrame = 0;
@@ -79,14 +80,33 @@ public:
    exit:;
    }
 
+   bool SetFormat(Format format, error *err)
+   {
+      switch (format)
+      {
+      case PcmShort:
+      case PcmFloat:
+         this->format = format;
+         return true;
+      default:
+         return false;
+      }
+   }
+
    int
    Read(void *buf, int len, error *err)
    {
       int r = 0;
       int oldChannels = op_channel_count(file, -1);
       int channels;
-      const int bps = 2;
-      r = op_read(file, (opus_int16*)buf, len/(bps * oldChannels), nullptr);
+      const int bps = GetBitsPerSample(format) / 8;
+
+      // Buffer sizes are in values, not samples per channel.
+      //
+      if (format == PcmFloat)
+         r = op_read_float(file, (float*)buf, len/bps, nullptr);
+      else
+         r = op_read(file, (opus_int16*)buf, len/bps, nullptr);
       if (r < 0)
          ERROR_SET(err, opusfile, r); 
       channels = op_channel_count(file, -1);
@@ -0,0 +1,234 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef packedtable_h_
+#define packedtable_h_
+
+#include <common/error.h>
+#include <common/misc.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace audio {
+
+//
+// A table of integers, such as per-sample sizes or offsets from a
+// container, that would otherwise be a vector holding one word per entry.
+//
+// Each entry is stored as the difference from the one before it, zigzag
+// encoded so small negative steps stay small, in a little-endian base-128
+// varint.  Every BlockSize entries an anchor records the absolute value and
+// where the block's bytes start, so a random lookup decodes at most one
+// block.  The last position decoded is remembered, so walking the table in
+// order costs O(1) per entry.
+//
+class PackedTable
+{
+   enum { BlockSize = 64 };
+
+   struct Anchor
+   {
+      uint64_t Value;
+      size_t Offset;
+   };
+
+   std::vector<Anchor> anchors;
+   std::vector<unsigned char> data;
+   size_t count;
+   uint64_t last;
+
+   // The last entry decoded, the one before it, and where the entry after
+   // it starts in data.
+   //
+   size_t cursorIndex;
+   size_t cursorOffset;
+   uint64_t cursorValue;
+   uint64_t cursorPrevValue;
+
+   static uint64_t
+   Decode(const unsigned char *&p)
+   {
+      uint64_t r = 0;
+      int shift = 0;
+      unsigned char ch;
+
+      do
+      {
+         ch = *p++;
+         r |= (uint64_t)(ch & 0x7f) << shift;
+         shift += 7;
+      } while (ch & 0x80);
+
+      return (r >> 1) ^ (0 - (r & 1));
+   }
+
+   // Position the cursor at the start of the block holding @idx.
+   //
+   void
+   SeekBlock(size_t idx)
+   {
+      auto &anchor = anchors[idx / BlockSize];
+
+      cursorIndex = idx - idx % BlockSize;
+      cursorOffset = anchor.Offset;
+      cursorValue = anchor.Value;
+      cursorPrevValue = 0;
+   }
+
+   void
+   Step(void)
+   {
+      const unsigned char *p = data.data() + cursorOffset;
+
+      cursorPrevValue = cursorValue;
+      cursorValue += Decode(p);
+      cursorOffset = p - data.data();
+      ++cursorIndex;
+   }
+
+public:
+
+   PackedTable()
+      : count(0),
+        last(0),
+        cursorIndex(0),
+        cursorOffset(0),
+        cursorValue(0),
+        cursorPrevValue(0)
+   {
+   }
+
+   size_t Size(void) const { return count; }
+
+   void
+   Append(uint64_t value, error *err)
+   {
+      try
+      {
+         if (!(count % BlockSize))
+         {
+            Anchor anchor;
+
+            anchor.Value = value;
+            anchor.Offset = data.size();
+            anchors.push_back(anchor);
+
+            if (!count)
+               SeekBlock(0);
+         }
+         else
+         {
+            uint64_t delta = value - last;
+            uint64_t zz = (delta << 1) ^ (0 - (delta >> 63));
+
+            while (zz >= 0x80)
+            {
+               data.push_back((zz & 0x7f) | 0x80);
+               zz >>= 7;
+            }
+            data.push_back(zz);
+         }
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+
+      last = value;
+      ++count;
+   exit:;
+   }
+
+   // Give back what's left over from growing the vectors.
+   //
+   void
+   Shrink(void)
+   {
+      anchors.shrink_to_fit();
+      data.shrink_to_fit();
+   }
+
+   void
+   Clear(void)
+   {
+      anchors.clear();
+      data.clear();
+      Shrink();
+      count = 0;
+      last = 0;
+      cursorIndex = cursorOffset = 0;
+      cursorValue = cursorPrevValue = 0;
+   }
+
+   // @idx must be less than Size().
+   //
+   uint64_t
+   Get(size_t idx)
+   {
+      if (idx + 1 == cursorIndex && idx % BlockSize != BlockSize - 1)
+         return cursorPrevValue;
+
+      if (idx < cursorIndex || idx / BlockSize != cursorIndex / BlockSize)
+         SeekBlock(idx);
+
+      while (cursorIndex < idx)
+         Step();
+
+      return cursorValue;
+   }
+
+   // For tables that never decrease: the index of the last entry that is
+   // no greater than @value, or 0 if there is none.
+   //
+   size_t
+   FindLast(uint64_t value)
+   {
+      size_t end = 0;
+      auto p = std::upper_bound(
+         anchors.begin(),
+         anchors.end(),
+         value,
+         [] (uint64_t value, const Anchor &anchor) -> bool
+         {
+            return value < anchor.Value;
+         }
+      );
+
+      if (p == anchors.begin())
+         return 0;
+      --p;
+
+      SeekBlock((p - anchors.begin()) * BlockSize);
+      end = MIN(count, cursorIndex + BlockSize);
+
+      while (cursorIndex + 1 < end)
+      {
+         const unsigned char *q = data.data() + cursorOffset;
+
+         if (cursorValue + Decode(q) > value)
+            break;
+         Step();
+      }
+
+      return cursorIndex;
+   }
+
+   size_t
+   GetMemoryUsage(void) const
+   {
+      return anchors.capacity() * sizeof(Anchor) + data.capacity();
+   }
+};
+
+} // end namespace
+
+#endif
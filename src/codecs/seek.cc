@@ -11,16 +11,300 @@
 
 #include <string.h>
 #include <errno.h>
+#include <limits.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include <common/time.h>
 #include <common/misc.h>
+#include <common/logger.h>
+#include <common/c++/worker.h>
 
 using namespace common;
 using namespace audio;
 
+namespace audio {
+
+//
+// Walks the frames of a second handle on the file, on a thread of its
+// own, reading a window at a time and handing each header to a parser
+// that doesn't touch the source.  The playback cursor never moves.
+//
+class DurationScan
+{
+   Pointer<Stream> stream;
+   uint64_t dataOffset;
+   int headerBytes;
+   SeekBase::FrameParser parse;
+   common::Event<uint64_t> *refined;
+   std::shared_ptr<FrameIndexSeekTable> frameIndex;
+   std::atomic<uint64_t> estimate;
+   std::atomic<bool> exact;
+   std::atomic<bool> cancelled;
+   WorkerThread *thread;
+
+   void
+   Report(uint64_t duration, bool done)
+   {
+      error err;
+
+      if (!done && duration == estimate)
+         return;
+
+      estimate = duration;
+      if (done)
+         exact = true;
+
+      if (refined)
+         refined->Invoke(duration, &err);
+   }
+
+   void
+   Run(void)
+   {
+      std::vector<unsigned char> window;
+      uint64_t off = dataOffset;
+      uint64_t time = 0;
+      uint64_t size = 0;
+      uint64_t lastReport = get_monotonic_time_millis();
+      common::StreamInfo info;
+      error innerErr;
+      error *err = &innerErr;
+
+      stream->GetStreamInfo(&info, err);
+      ERROR_CHECK(err);
+      if (info.FileSizeKnown)
+      {
+         size = stream->GetSize(err);
+         ERROR_CHECK(err);
+      }
+
+      try
+      {
+         window.resize(65536);
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+
+      while (!cancelled)
+      {
+         int n = 0, i = 0;
+         bool atEnd = false;
+
+         stream->Seek(off, SEEK_SET, err);
+         ERROR_CHECK(err);
+
+         n = stream->Read(window.data(), window.size(), err);
+         ERROR_CHECK(err);
+
+         atEnd = (n < (int)window.size());
+
+         while (i + headerBytes <= n)
+         {
+            uint64_t frameDuration = 0;
+            int len = parse(window.data() + i, n - i, frameDuration);
+
+            if (!len)
+            {
+               ++i;
+               continue;
+            }
+
+            // Finish this frame in the next window.
+            //
+            if (i + len > n && !atEnd)
+               break;
+
+            if (frameIndex.get())
+            {
+               frameIndex->OnFrame(time, off + i - dataOffset, err);
+               ERROR_CHECK(err);
+            }
+
+            time += frameDuration;
+            i += len;
+         }
+
+         if (atEnd)
+         {
+            if (frameIndex.get())
+               frameIndex->SetDuration(time);
+            Report(time, true);
+            break;
+         }
+
+         off += MAX(i, 1);
+
+         auto now = get_monotonic_time_millis();
+         if (size > off && now - lastReport >= 250)
+         {
+            Report((size - dataOffset) * ((time + 0.0) / (off - dataOffset)), false);
+            lastReport = now;
+         }
+      }
+
+   exit:
+      // On error, the last estimate is as good as it gets.
+      ;
+   }
+
+public:
+   DurationScan(
+      Stream *stream_,
+      uint64_t dataOffset_,
+      int headerBytes_,
+      const SeekBase::FrameParser &parse_,
+      common::Event<uint64_t> *refined_,
+      const std::shared_ptr<FrameIndexSeekTable> &frameIndex_
+   ) :
+      stream(stream_),
+      dataOffset(dataOffset_),
+      headerBytes(headerBytes_),
+      parse(parse_),
+      refined(refined_),
+      frameIndex(frameIndex_),
+      estimate(0),
+      exact(false),
+      cancelled(false),
+      thread(nullptr)
+   {
+   }
+
+   ~DurationScan()
+   {
+      cancelled = true;
+      if (thread)
+         delete thread;
+   }
+
+   // Guess from the first frame's bitrate, so there is something to
+   // report before the scan gets going.
+   //
+   void
+   Start(error *err)
+   {
+      unsigned char buf[64];
+      uint64_t frameDuration = 0;
+      int n = 0, len = 0;
+      common::StreamInfo info;
+
+      stream->GetStreamInfo(&info, err);
+      ERROR_CHECK(err);
+
+      stream->Seek(dataOffset, SEEK_SET, err);
+      ERROR_CHECK(err);
+
+      n = stream->Read(buf, MIN(sizeof(buf), (size_t)headerBytes), err);
+      ERROR_CHECK(err);
+
+      if (info.FileSizeKnown && n == headerBytes &&
+          (len = parse(buf, n, frameDuration)))
+      {
+         auto size = stream->GetSize(err);
+         ERROR_CHECK(err);
+         if (size > dataOffset)
+            estimate = (size - dataOffset) * frameDuration / len;
+      }
+
+      try
+      {
+         thread = new WorkerThread();
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+
+      thread->Schedule(
+         [this] (error *err) -> void
+         {
+            Run();
+         }
+      );
+   exit:;
+   }
+
+   uint64_t GetEstimate(void) const { return estimate; }
+   bool IsExact(void) const { return exact; }
+};
+
+} // end namespace
+
 audio::SeekBase::SeekBase(uint64_t duration)
-   : cachedDuration(duration)
+   : cachedDuration(duration),
+     durationScan(nullptr)
+{
+}
+
+audio::SeekBase::~SeekBase()
 {
+   if (durationScan)
+      delete durationScan;
+}
+
+void
+audio::SeekBase::SetDurationScan(
+   common::Stream *stream,
+   uint64_t dataOffset,
+   int headerBytes,
+   const FrameParser &parse,
+   common::Event<uint64_t> *refined,
+   error *err
+)
+{
+   DurationScan *scan = nullptr;
+
+   if (!stream || cachedDuration || durationScan)
+      goto exit;
+
+   try
+   {
+      scan = new DurationScan(stream, dataOffset, headerBytes, parse, refined, frameIndex);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   scan->Start(err);
+   ERROR_CHECK(err);
+
+   durationScan = scan;
+   scan = nullptr;
+exit:
+   if (scan)
+      delete scan;
+}
+
+bool
+audio::SeekBase::GetDurationKnown(void) const
+{
+   return cachedDuration != 0 || (durationScan && durationScan->IsExact());
+}
+
+void
+audio::SeekBase::SetFrameIndex(
+   const std::shared_ptr<FrameIndexSeekTable> &frameIndex,
+   common::Stream *stream,
+   uint64_t dataOffset,
+   error *err
+)
+{
+   if (!frameIndex.get())
+      goto exit;
+
+   frameIndex->Bind(stream, dataOffset, err);
+   ERROR_CHECK(err);
+
+   this->frameIndex = frameIndex;
+
+   if (!cachedDuration)
+      cachedDuration = frameIndex->GetDuration();
+exit:;
 }
 
 void
@@ -34,7 +318,20 @@ audio::SeekBase::Seek(uint64_t pos, error *err)
    if (pos >= currentPos && pos <= nextPos)
       return;
 
-   if (seekTable.get() && (seekTable->Lookup(pos, seekTableDuration, seekTableOff, err) || ERROR_FAILED(err)))
+   if (frameIndex.get() && (frameIndex->Lookup(pos, seekTableDuration, seekTableOff, err) || ERROR_FAILED(err)))
+   {
+      ERROR_CHECK(err);
+
+      // Index entries are exact frame boundaries.  If we're already
+      // between the entry and the target, walking forward is cheaper.
+      //
+      if (pos < currentPos || seekTableDuration > currentPos)
+      {
+         SeekToOffset(seekTableOff, seekTableDuration, err);
+         ERROR_CHECK(err);
+      }
+   }
+   else if (seekTable.get() && (seekTable->Lookup(pos, seekTableDuration, seekTableOff, err) || ERROR_FAILED(err)))
    {
       ERROR_CHECK(err);
 
@@ -47,6 +344,9 @@ audio::SeekBase::Seek(uint64_t pos, error *err)
       ERROR_CHECK(err);
    }
 
+   SkipFrames(pos, err);
+   ERROR_CHECK(err);
+
    while (GetPosition() + (duration = GetNextDuration()) < pos)
    {
       if (!duration)
@@ -59,18 +359,109 @@ audio::SeekBase::Seek(uint64_t pos, error *err)
 exit:;
 }
 
+//
+// Gets close to @pos by reading the stream a block at a time and walking
+// frame headers in memory, then lands there with one SeekToOffset().
+// Anything the parser doesn't like, such as junk that needs a resync or
+// the end of the file, is left for the caller to SkipFrame() through.
+//
+void
+audio::SeekBase::SkipFrames(uint64_t pos, error *err)
+{
+   const int minFrames = 16;
+   common::Stream *stream = nullptr;
+   std::vector<unsigned char> window;
+   FrameParser parse;
+   uint64_t base = 0, off = 0;
+   uint64_t time = GetPosition();
+   uint64_t duration = GetNextDuration();
+   int headerBytes = 0;
+   bool done = false;
+
+   if (!duration || pos <= time || (pos - time) / duration < minFrames)
+      goto exit;
+
+   if (!GetFrameParser(&stream, base, headerBytes, parse))
+      goto exit;
+
+   if (!GetFrameOffset(off, err))
+      goto exit;
+
+   try
+   {
+      window.resize(65536);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   while (!done)
+   {
+      int n = 0, i = 0;
+
+      stream->Seek(base + off, SEEK_SET, err);
+      ERROR_CHECK(err);
+
+      n = stream->Read(window.data(), window.size(), err);
+      ERROR_CHECK(err);
+
+      for (;;)
+      {
+         int len = 0;
+
+         if (i + headerBytes > n)
+         {
+            done = (n < (int)window.size());
+            break;
+         }
+
+         len = parse(window.data() + i, n - i, duration);
+         if (!len || time + duration >= pos)
+         {
+            done = true;
+            break;
+         }
+
+         time += duration;
+         i += len;
+
+         // The next header is in a later block.
+         //
+         if (i > n)
+            break;
+      }
+
+      off += i;
+   }
+
+   // We have moved the stream, even if we skipped nothing.
+   //
+   SeekToOffset(off, time, err);
+   ERROR_CHECK(err);
+exit:;
+}
+
 uint64_t
 audio::SeekBase::GetDuration(error *err)
 {
    if (cachedDuration)
       return cachedDuration;
 
+   if (durationScan)
+   {
+      if (durationScan->IsExact())
+         cachedDuration = durationScan->GetEstimate();
+      return durationScan->GetEstimate();
+   }
+
    uint64_t r = GetPosition();
    uint64_t frame;
    RollbackBase *rollback = nullptr;
    common::Stream *stream = nullptr;
    uint64_t startPos = 0;
    uint64_t startTime = 0;
+   bool extrapolated = false;
 
    try
    {
@@ -92,6 +483,15 @@ audio::SeekBase::GetDuration(error *err)
 
    while ((frame = GetNextDuration()))
    {
+      uint64_t off = 0;
+
+      if (frameIndex.get() && (GetFrameOffset(off, err) || ERROR_FAILED(err)))
+      {
+         ERROR_CHECK(err);
+         frameIndex->OnFrame(r, off, err);
+         ERROR_CHECK(err);
+      }
+
       SkipFrame(err);
       ERROR_CHECK(err);
 
@@ -115,6 +515,7 @@ audio::SeekBase::GetDuration(error *err)
                auto sz = stream->GetSize(err);
                ERROR_CHECK(err);
                r = MAX(0, sz - startPos) * ((r + 0.0) / bytes);
+               extrapolated = true;
                break;
             }
          }
@@ -122,11 +523,267 @@ audio::SeekBase::GetDuration(error *err)
    }
 
    cachedDuration = r;
+
+   if (frameIndex.get() && !extrapolated)
+      frameIndex->SetDuration(r);
 exit:
    if (rollback) delete rollback;
    return r;
 }
 
+//
+// FrameIndexSeekTable
+//
+
+namespace {
+
+const unsigned char frameIndexMagic[] = {'F', 'I', 'D', 'X'};
+const uint32_t frameIndexVersion = 2;
+const size_t frameIndexHeaderSize = 40;
+const size_t frameIndexEntrySize = 16;
+
+void
+Put32(unsigned char *p, uint32_t x)
+{
+   for (int i=0; i<4; ++i)
+      p[i] = (x >> (i * 8));
+}
+
+void
+Put64(unsigned char *p, uint64_t x)
+{
+   Put32(p, x);
+   Put32(p + 4, x >> 32);
+}
+
+uint32_t
+Get32(const unsigned char *p)
+{
+   return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint64_t
+Get64(const unsigned char *p)
+{
+   return Get32(p) | ((uint64_t)Get32(p + 4) << 32);
+}
+
+} // end namespace
+
+audio::FrameIndexSeekTable::FrameIndexSeekTable(int framesPerEntry_)
+   : framesPerEntry(MAX(1, framesPerEntry_)),
+     framesSinceEntry(0),
+     duration(0),
+     fileSize(0),
+     dataOffset(0)
+{
+}
+
+bool
+audio::FrameIndexSeekTable::Lookup(
+   uint64_t desiredTime,
+   uint64_t &time,
+   uint64_t &fileOffset,
+   error *err
+)
+{
+   std::lock_guard<std::mutex> l(lock);
+   auto p = std::upper_bound(
+      entries.begin(),
+      entries.end(),
+      desiredTime,
+      [] (uint64_t t, const Entry &e) -> bool { return t < e.Time; }
+   );
+
+   if (p == entries.begin())
+      return false;
+
+   --p;
+   time = p->Time;
+   fileOffset = p->FileOffset;
+   return true;
+}
+
+void
+audio::FrameIndexSeekTable::OnFrame(uint64_t time, uint64_t fileOffset, error *err)
+{
+   std::lock_guard<std::mutex> l(lock);
+
+   if (entries.size())
+   {
+      // Already covered by an earlier scan.  Count again from here, so
+      // that a walk picking up where that one left off leaves the same
+      // gap after the last entry as between the others.
+      //
+      if (time <= entries.back().Time)
+      {
+         framesSinceEntry = 0;
+         goto exit;
+      }
+
+      if (++framesSinceEntry < framesPerEntry)
+         goto exit;
+   }
+
+   try
+   {
+      entries.push_back({time, fileOffset});
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+   framesSinceEntry = 0;
+exit:;
+}
+
+void
+audio::FrameIndexSeekTable::SetDuration(uint64_t duration)
+{
+   std::lock_guard<std::mutex> l(lock);
+   this->duration = duration;
+}
+
+uint64_t
+audio::FrameIndexSeekTable::GetDuration(void) const
+{
+   std::lock_guard<std::mutex> l(lock);
+   return duration;
+}
+
+bool
+audio::FrameIndexSeekTable::Bind(common::Stream *file, uint64_t dataOffset, error *err)
+{
+   bool r = true;
+   uint64_t size = 0;
+   common::StreamInfo info;
+
+   file->GetStreamInfo(&info, err);
+   ERROR_CHECK(err);
+   if (info.FileSizeKnown)
+   {
+      size = file->GetSize(err);
+      ERROR_CHECK(err);
+   }
+
+   {
+      std::lock_guard<std::mutex> l(lock);
+
+      if ((entries.size() || duration) &&
+          (fileSize != size || this->dataOffset != dataOffset))
+      {
+         log_printf("seek: Frame index is for a different file, rebuilding.");
+         entries.clear();
+         framesSinceEntry = 0;
+         duration = 0;
+         r = false;
+      }
+
+      fileSize = size;
+      this->dataOffset = dataOffset;
+   }
+exit:
+   return r;
+}
+
+void
+audio::FrameIndexSeekTable::Serialize(std::vector<unsigned char> &buf, error *err)
+{
+   std::lock_guard<std::mutex> l(lock);
+   unsigned char *p = nullptr;
+
+   try
+   {
+      buf.resize(frameIndexHeaderSize + entries.size() * frameIndexEntrySize);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   p = buf.data();
+
+   memcpy(p, frameIndexMagic, sizeof(frameIndexMagic));
+   Put32(p + 4, frameIndexVersion);
+   Put32(p + 8, framesPerEntry);
+   Put32(p + 12, entries.size());
+   Put64(p + 16, duration);
+   Put64(p + 24, fileSize);
+   Put64(p + 32, dataOffset);
+   p += frameIndexHeaderSize;
+
+   for (auto &e : entries)
+   {
+      Put64(p, e.Time);
+      Put64(p + 8, e.FileOffset);
+      p += frameIndexEntrySize;
+   }
+exit:;
+}
+
+void
+audio::FrameIndexSeekTable::Deserialize(
+   const void *buf,
+   size_t len,
+   uint64_t fileSize,
+   error *err
+)
+{
+   auto p = (const unsigned char*)buf;
+   std::vector<Entry> newEntries;
+   uint32_t n = 0, per = 0;
+
+   if (len < frameIndexHeaderSize ||
+       memcmp(p, frameIndexMagic, sizeof(frameIndexMagic)) ||
+       Get32(p + 4) != frameIndexVersion)
+   {
+      ERROR_SET(err, unknown, "Not a frame index");
+   }
+
+   if (Get64(p + 24) != fileSize)
+      ERROR_SET(err, unknown, "Frame index is for a different file");
+
+   per = Get32(p + 8);
+   if (per > INT_MAX)
+      ERROR_SET(err, unknown, "Frame index has a bad entry interval");
+
+   n = Get32(p + 12);
+   if ((len - frameIndexHeaderSize) / frameIndexEntrySize < n)
+      ERROR_SET(err, unknown, "Frame index is truncated");
+
+   try
+   {
+      newEntries.resize(n);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   for (uint32_t i=0; i<n; ++i)
+   {
+      auto q = p + frameIndexHeaderSize + i * frameIndexEntrySize;
+      auto &e = newEntries[i];
+
+      e.Time = Get64(q);
+      e.FileOffset = Get64(q + 8);
+
+      if (i && e.Time <= newEntries[i-1].Time)
+         ERROR_SET(err, unknown, "Frame index entries out of order");
+   }
+
+   {
+      std::lock_guard<std::mutex> l(lock);
+
+      framesPerEntry = MAX(1, (int)per);
+      framesSinceEntry = 0;
+      duration = Get64(p + 16);
+      this->fileSize = fileSize;
+      dataOffset = Get64(p + 32);
+      entries.swap(newEntries);
+   }
+exit:;
+}
 
 //
 // XXX this breaks some abstractions, we'll take some guesses about some common
@@ -10,28 +10,91 @@
 #define seekbase_h_
 
 #include "rollback.h"
+#include <common/c++/event.h>
 #include <common/c++/stream.h>
+#include <functional>
 #include <memory>
 
 namespace audio {
 
 struct SeekTable;
+struct FrameIndexSeekTable;
+class DurationScan;
 
 class SeekBase
 {
    uint64_t cachedDuration;
    std::shared_ptr<SeekTable> seekTable;
+   std::shared_ptr<FrameIndexSeekTable> frameIndex;
+   DurationScan *durationScan;
+
+   void SkipFrames(uint64_t pos, error *err);
+public:
+   // For a duration scan: returns the length in bytes of the frame whose
+   // header is at @p and sets @duration, or returns 0 if @p isn't a frame.
+   // This runs on the scan's own thread, so it must not touch the source.
+   //
+   typedef std::function<int(const unsigned char *p, int len, uint64_t &duration)> FrameParser;
 protected:
    virtual uint64_t GetPosition(void) = 0;
    virtual uint64_t GetNextDuration(void) = 0;
    virtual void SeekToOffset(uint64_t off, uint64_t time, error *err) = 0;
    virtual void SkipFrame(error *err) = 0;
    virtual void CapturePosition(RollbackBase **rollback, error *err) = 0;
+
+   // Offset of the frame described by GetNextDuration(), in the terms
+   // expected by SeekToOffset().  Needed to build a frame index.
+   //
+   virtual bool GetFrameOffset(uint64_t &off, error *err) { return false; }
+
+   // For skipping many frames at once by reading a block and walking the
+   // headers in memory, rather than calling SkipFrame() for each: the
+   // stream, where GetFrameOffset()'s offset 0 falls in it, and a parser.
+   // Return false to always go a frame at a time.
+   //
+   virtual bool
+   GetFrameParser(
+      common::Stream **stream,
+      uint64_t &base,
+      int &headerBytes,
+      FrameParser &parse
+   )
+   {
+      return false;
+   }
+
+   // Walk frames to find the duration on another thread, rather than
+   // blocking in GetDuration().  @stream is a second handle on the same
+   // file, whose cursor the scan can move as it likes; frames start at
+   // @dataOffset.  Until the scan finishes, GetDuration() returns an
+   // estimate, and @refined fires on the scan thread as it improves.
+   //
+   void SetDurationScan(
+      common::Stream *stream,
+      uint64_t dataOffset,
+      int headerBytes,
+      const FrameParser &parse,
+      common::Event<uint64_t> *refined,
+      error *err
+   );
+
+   // Record frames into @frameIndex as they are walked, or use it in
+   // place of walking if it is complete.  @stream and @dataOffset identify
+   // the file, as for FrameIndexSeekTable::Bind().  Call this before
+   // SetDurationScan(), so that the scan fills in the index.
+   //
+   void SetFrameIndex(
+      const std::shared_ptr<FrameIndexSeekTable> &frameIndex,
+      common::Stream *stream,
+      uint64_t dataOffset,
+      error *err
+   );
 public:
    SeekBase(uint64_t duration = 0);
+   ~SeekBase();
    void Seek(uint64_t pos, error *err);
    uint64_t GetDuration(error *err);
-   bool GetDurationKnown(void) const { return cachedDuration != 0; }
+   bool GetDurationKnown(void) const;
    void SetCachedDuration(uint64_t duration) { cachedDuration = duration; }
    void SetSeekTable(const std::shared_ptr<SeekTable> &seekTable) { this->seekTable = seekTable; }
 };
@@ -0,0 +1,152 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#include "sniff.h"
+#include "mpegheader.h"
+#include "syncscan.h"
+
+#include <common/misc.h>
+
+#include <string.h>
+
+using namespace audio;
+
+namespace {
+
+// Returns the length of the MPEG audio or ADTS frame whose header is at
+// @p, or 0 if it isn't a plausible header.  @key gets the header bits
+// that stay the same from one frame of a stream to the next.
+//
+int
+GetMpegFrameLength(const unsigned char *p, int len, unsigned &key)
+{
+   MpegAudioHeader mpeg;
+   AdtsHeader adts;
+
+   if (len >= MpegAudioHeaderBytes && ParseMpegAudioHeader(p, mpeg))
+   {
+      key = mpeg.Key;
+      return mpeg.FrameSize;
+   }
+   if (len >= AdtsHeaderBytes && ParseAdtsHeader(p, adts))
+   {
+      key = adts.Key;
+      return adts.FrameSize;
+   }
+   return 0;
+}
+
+int
+ScoreMp4(const unsigned char *p, int len)
+{
+   return (len >= 8 && !memcmp(p + 4, "ftyp", 4)) ? 100 : 0;
+}
+
+int
+ScoreOgg(const unsigned char *p, int len)
+{
+   const unsigned char *pastHeader = p + 0x1c;
+
+   if (len < 0x1c + 8 || memcmp(p, "OggS", 4))
+      return 0;
+
+   if (!memcmp(pastHeader, "\1vorbis", 7) ||
+       !memcmp(pastHeader, "OpusHead", 8) ||
+       !memcmp(pastHeader, "\x7f""FLAC", 5))
+   {
+      return 100;
+   }
+
+   return 0;
+}
+
+int
+ScoreFlac(const unsigned char *p, int len)
+{
+   return (len >= 4 && !memcmp(p, "fLaC", 4)) ? 100 : 0;
+}
+
+int
+ScoreWav(const unsigned char *p, int len)
+{
+   return (len >= 12 && !memcmp(p, "RIFF", 4) && !memcmp(p + 8, "WAVE", 4)) ? 100 : 0;
+}
+
+int
+ScoreAmr(const unsigned char *p, int len)
+{
+   return (len >= 5 && !memcmp(p, "#!AMR", 5)) ? 100 : 0;
+}
+
+// Magic numbers beat this, but the longer the run, the surer we are.
+//
+int
+ScoreMpegAudio(const unsigned char *p, int len)
+{
+   MpegFrameRun run;
+
+   if (!FindMpegFrameRun(p, len, 0, run))
+      return 0;
+
+   return 10 * MIN(run.Frames, 9);
+}
+
+const struct
+{
+   FileType Type;
+   int (*Score)(const unsigned char *p, int len);
+} sniffers[] =
+{
+   {FileTypeMp4,       ScoreMp4},
+   {FileTypeOgg,       ScoreOgg},
+   {FileTypeFlac,      ScoreFlac},
+   {FileTypeWav,       ScoreWav},
+   {FileTypeAmr,       ScoreAmr},
+   {FileTypeMpegAudio, ScoreMpegAudio},
+};
+
+} // end namespace
+
+bool
+audio::FindMpegFrameRun(const void *buf, int len, int start, MpegFrameRun &run)
+{
+   const unsigned char *p = (const unsigned char *)buf;
+   int frames = 0, resume = 0;
+   int off = FindFrameRun(
+      p, len, MAX(start, 0), 0xe0, AdtsHeaderBytes, 2, false,
+      GetMpegFrameLength, frames, resume
+   );
+
+   if (off < 0)
+      return false;
+
+   run.Offset = off;
+   run.Frames = frames;
+   run.Adts = !(p[off + 1] & 0x06);
+   return true;
+}
+
+FileType
+audio::SniffFileType(const void *buf, int len)
+{
+   const unsigned char *p = (const unsigned char *)buf;
+   FileType r = FileTypeUnknown;
+   int best = 0;
+
+   for (auto &sniffer : sniffers)
+   {
+      int score = sniffer.Score(p, len);
+      if (score > best)
+      {
+         best = score;
+         r = sniffer.Type;
+      }
+   }
+
+   return r;
+}
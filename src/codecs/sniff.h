@@ -0,0 +1,41 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef sniff_h_
+#define sniff_h_
+
+#include <AudioCodec.h>
+
+namespace audio {
+
+//
+// Frames of MPEG audio or ADTS that follow one another in a buffer, each
+// header's frame length landing on the next header.
+//
+struct MpegFrameRun
+{
+   int Offset;
+   int Frames;
+   bool Adts;
+};
+
+// Finds the first run of two or more at or after @start.  A run cut short
+// by the end of the buffer counts only if it begins at @start.
+//
+bool
+FindMpegFrameRun(const void *buf, int len, int start, MpegFrameRun &run);
+
+// Looks over the start of a file once, and returns the type that scores
+// best, or FileTypeUnknown if nothing fits.
+//
+FileType
+SniffFileType(const void *buf, int len);
+
+} // end namespace
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#ifndef syncscan_h_
+#define syncscan_h_
+
+#include <common/c++/stream.h>
+#include <common/error.h>
+#include <common/misc.h>
+
+#include <string.h>
+#include <vector>
+
+namespace audio {
+
+//
+// Finding frame sync in MPEG audio and ADTS, where a frame starts with an
+// 0xff byte and a second byte with some high bits set.  Scans run over a
+// window in memory: memchr() finds the 0xff bytes, which any decent libc
+// does a vector register at a time, and only those get a closer look.
+//
+
+// How many frames in a row have to parse before we believe a resync.
+//
+const int SyncRunFrames = 3;
+
+inline const unsigned char *
+FindSyncWord(const unsigned char *p, const unsigned char *end, unsigned char mask)
+{
+   while (end - p >= 2)
+   {
+      p = (const unsigned char *)memchr(p, 0xff, end - p - 1);
+      if (!p)
+         break;
+      if ((p[1] & mask) == mask)
+         return p;
+      ++p;
+   }
+   return nullptr;
+}
+
+//
+// Looks in @buf, starting at @start, for a header that @parse accepts and
+// whose frame length leads to more headers it accepts, until there are
+// @minFrames in a row.
+//
+// @parse(p, len, key) returns the length of the frame at @p, or 0 if it
+// isn't a header.  It sets @key to whatever must stay the same from one
+// frame to the next.
+//
+// A run that goes past the end of the window before it's long enough
+// only counts if it started at @start, or @atEnd says nothing follows.
+// Otherwise we return -1 and set @resume to where the next window should
+// start, so that the run gets another look.
+//
+template <class Parse>
+int
+FindFrameRun(
+   const unsigned char *buf,
+   int len,
+   int start,
+   unsigned char mask,
+   int headerBytes,
+   int minFrames,
+   bool atEnd,
+   Parse parse,
+   int &frames,
+   int &resume
+)
+{
+   const unsigned char *p = buf + start;
+   const unsigned char *end = buf + len;
+
+   resume = MAX(start, len - headerBytes + 1);
+
+   while ((p = FindSyncWord(p, end, mask)))
+   {
+      int off = p - buf;
+      unsigned key = 0, nextKey = 0;
+      int frameLen = parse(p, len - off, key);
+      int next = off + frameLen;
+
+      if (!frameLen)
+      {
+         if (off + headerBytes > len)
+         {
+            resume = MIN(resume, off);
+            break;
+         }
+         ++p;
+         continue;
+      }
+
+      for (frames = 1; frames < minFrames && next + headerBytes <= len; ++frames)
+      {
+         frameLen = parse(buf + next, len - next, nextKey);
+         if (!frameLen || nextKey != key)
+            break;
+         next += frameLen;
+      }
+
+      if (frames >= minFrames)
+         return off;
+
+      if (next + headerBytes > len)
+      {
+         if (atEnd || off == start)
+            return off;
+         resume = MIN(resume, off);
+         break;
+      }
+
+      ++p;
+   }
+
+   return -1;
+}
+
+//
+// For a decoder that just read a @headerBytes frame header from @stream
+// and found it was no good: read ahead a window at a time until there is
+// a run of SyncRunFrames frames, then leave the stream just past the
+// first one's header and copy the header to @header.  Returns false if
+// the stream ends first.
+//
+template <class Parse>
+bool
+ResyncStream(
+   common::Stream *stream,
+   std::vector<unsigned char> &window,
+   unsigned char mask,
+   int headerBytes,
+   Parse parse,
+   unsigned char *header,
+   error *err
+)
+{
+   const size_t windowSize = 16384;
+   uint64_t pos = 0;
+   int start = 1;
+   bool r = false;
+
+   pos = stream->GetPosition(err);
+   ERROR_CHECK(err);
+   pos -= headerBytes;
+
+   try
+   {
+      window.resize(windowSize);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   for (;;)
+   {
+      int n = 0, off = 0, frames = 0, resume = 0;
+      bool atEnd = false;
+
+      stream->Seek(pos, SEEK_SET, err);
+      ERROR_CHECK(err);
+
+      n = stream->Read(window.data(), window.size(), err);
+      ERROR_CHECK(err);
+      if (n < headerBytes)
+         goto exit;
+
+      atEnd = (n < (int)window.size());
+
+      off = FindFrameRun(
+         window.data(), n, start, mask, headerBytes, SyncRunFrames, atEnd,
+         parse, frames, resume
+      );
+      if (off >= 0)
+      {
+         memcpy(header, window.data() + off, headerBytes);
+         stream->Seek(pos + off + headerBytes, SEEK_SET, err);
+         ERROR_CHECK(err);
+         r = true;
+         goto exit;
+      }
+      if (atEnd)
+         goto exit;
+
+      pos += MAX(resume, 1);
+      start = 0;
+   }
+
+exit:
+   return r;
+}
+
+} // end namespace
+
+#endif
@@ -11,6 +11,8 @@
 #include <common/misc.h>
 #include <common/size.h>
 
+#include "carryover.h"
+
 using namespace common;
 using namespace audio;
 
@@ -24,13 +26,61 @@ namespace {
 
 extern ov_callbacks callbacks;
 
+// ov_read_float() gives one array per channel.
+//
+void
+Interleave(float **pcm, int channels, long n, float *out)
+{
+   switch (channels)
+   {
+   case 1:
+      memcpy(out, pcm[0], n * sizeof(float));
+      break;
+   case 2:
+      {
+         const float *l = pcm[0];
+         const float *r = pcm[1];
+         for (long i=0; i<n; ++i)
+         {
+            out[2*i] = l[i];
+            out[2*i+1] = r[i];
+         }
+      }
+      break;
+   default:
+      for (int c=0; c<channels; ++c)
+      {
+         const float *in = pcm[c];
+         float *p = out + c;
+         for (long i=0; i<n; ++i, p += channels)
+            *p = in[i];
+      }
+   }
+}
+
 class VorbisFile : public Source
 {
    Pointer<Stream> stream;
    OggVorbis_File file;
+   Format format;
+
+   // What GetMetadata() last told the caller.  A chained stream can
+   // switch to a link with different values partway through.
+   //
+   int channels;
+   long rate;
+
+   // Samples from a new link, held back until the caller has seen
+   // MetadataChanged and asked for the new format.
+   //
+   CarryOver carryOver;
+
 public:
    VorbisFile(Stream *stream_) :
-      stream(stream_)
+      stream(stream_),
+      format(PcmShort),
+      channels(0),
+      rate(0)
    {
       memset(&file, 0, sizeof(file));
    }
@@ -74,22 +124,65 @@ public:
       if (!p)
          ERROR_SET(err, unknown, "ov_info returned null");
 
-      res->Format = PcmShort;
+      res->Format = format;
       res->SampleRate = p->rate;
       res->Channels = p->channels;
       res->SamplesPerFrame = 0;
 
+      channels = p->channels;
+      rate = p->rate;
+
       ApplyChannelLayout(*res, GetCommonOggChannelLayout, err);
       ERROR_CHECK(err);
    exit:;
    }
 
+   bool SetFormat(Format format, error *err)
+   {
+      // Held-back samples are already in the old format.
+      //
+      if (format != this->format && !carryOver.Empty())
+         return false;
+
+      switch (format)
+      {
+      case PcmShort:
+      case PcmFloat:
+         this->format = format;
+         return true;
+      default:
+         return false;
+      }
+   }
+
    int
    Read(void *buf, int len, error *err)
    {
       int endian = 1;
       int bitstream;
-      long r = ov_read(
+      long r = 0;
+
+      if (!carryOver.Empty())
+      {
+         // Whole samples only, in the new link's layout.
+         //
+         int frameSize = channels * (format == PcmFloat ? sizeof(float) : 2);
+
+         len -= len % frameSize;
+         if (!len)
+            ERROR_SET(err, unknown, "Buffer too small for one sample");
+
+         r = carryOver.Drain(buf, len);
+         goto exit;
+      }
+
+      if (format == PcmFloat)
+      {
+         r = ReadFloat(buf, len, err);
+         goto exit;
+      }
+
+      r = ov_read(
          &file,
          (char*)buf,
          len,
@@ -100,12 +193,22 @@ public:
       );
       if (r < 0)
          ERROR_SET(err, vorbis, r);
+
+      if (r && LinkChanged(bitstream, err))
+      {
+         void *p = carryOver.Prepare(r, 0, err);
+         ERROR_CHECK(err);
+         memcpy(p, buf, r);
+         r = 0;
+      }
+      ERROR_CHECK(err);
    exit:
       return r;
    }
 
    void Seek(uint64_t pos, error *err)
    {
+      carryOver.Clear();
       if (ov_time_seek(&file, pos / 10000000.0))
          ERROR_SET(err, unknown, "failed to seek");
    exit:;
@@ -135,6 +238,81 @@ public:
 
 private:
 
+   // The decoder works in float, so this skips ov_read()'s conversion
+   // to 16 bits along with our conversion back.
+   //
+   int
+   ReadFloat(void *buf, int len, error *err)
+   {
+      int bitstream;
+      float **pcm = nullptr;
+      long r = 0;
+      auto info = ov_info(&file, -1);
+      int linkChannels = info ? info->channels : 0;
+
+      if (!linkChannels)
+         ERROR_SET(err, unknown, "ov_info returned null");
+
+      // Sized for the link we're in, but what comes back may be from the
+      // next one, so go by what @bitstream says that is.
+      //
+      r = ov_read_float(&file, &pcm, len / (sizeof(float) * linkChannels), &bitstream);
+      if (r < 0)
+         ERROR_SET(err, vorbis, r);
+      if (!r)
+         goto exit;
+
+      info = ov_info(&file, bitstream);
+      if (!info)
+         ERROR_SET(err, unknown, "ov_info returned null");
+      linkChannels = info->channels;
+
+      if (LinkChanged(bitstream, err))
+      {
+         buf = carryOver.Prepare(r * sizeof(float) * linkChannels, 0, err);
+         ERROR_CHECK(err);
+         Interleave(pcm, linkChannels, r, (float*)buf);
+         r = 0;
+         goto exit;
+      }
+      ERROR_CHECK(err);
+
+      Interleave(pcm, linkChannels, r, (float*)buf);
+      r *= sizeof(float) * linkChannels;
+   exit:
+      return r;
+   }
+
+   // After a read from link @bitstream: if it doesn't match what the
+   // caller was told, set MetadataChanged and return true, and the read's
+   // samples go to carryOver for after the caller has caught up.
+   //
+   bool
+   LinkChanged(int bitstream, error *err)
+   {
+      auto info = ov_info(&file, bitstream);
+      bool r = false;
+
+      if (!info)
+         ERROR_SET(err, unknown, "ov_info returned null");
+
+      if (!channels)
+      {
+         // Nobody has asked for metadata yet, so there's nothing to
+         // change from.
+         //
+         channels = info->channels;
+         rate = info->rate;
+      }
+      else if (info->channels != channels || info->rate != rate)
+      {
+         MetadataChanged = true;
+         r = true;
+      }
+   exit:
+      return r;
+   }
+
    void
    error_set_vorbis(error *err, long code)
    {
@@ -65,28 +65,86 @@ read32(const uint32_t *ptr)
           (((uint32_t)p[3]) << 24);
 }
 
-uint32_t
-read24(const void *ptr)
+uint16_t
+read16(const uint16_t *ptr)
 {
    const unsigned char *p = (const unsigned char *)ptr;
-   return *p |
-          (((uint32_t)p[1]) << 8) |
-          (((uint32_t)p[2]) << 16);
+   return *p | (((uint16_t)p[1]) << 8);
 }
 
-void
-write24ne(unsigned char *p, uint32_t value)
+bool
+IsLittleEndian(void)
 {
-   int little_endian = 1;
-   char *q = ((char*)&value) + !*(char*)&little_endian;
-   memcpy(p, q, 3);
+   static const int little_endian = 1;
+   return *(const char*)&little_endian;
 }
 
-uint16_t
-read16(const uint16_t *ptr)
+#if defined(__GNUC__)
+#define bswap16 __builtin_bswap16
+#define bswap32 __builtin_bswap32
+#else
+uint16_t bswap16(uint16_t x) { return (x >> 8) | (x << 8); }
+uint32_t
+bswap32(uint32_t x)
 {
-   const unsigned char *p = (const unsigned char *)ptr;
-   return *p | (((uint16_t)p[1]) << 8);
+   return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+#endif
+
+// Turn little-endian samples from the file into @format, in place.
+// On little-endian hosts this is nothing except for 32-bit integer,
+// which we hand out as 24 bits in 32.  Otherwise these are simple
+// enough loops that the compiler can vectorize them.
+//
+void
+ToNative(Format format, void *buf, int len)
+{
+   switch (format)
+   {
+   case PcmShort:
+      if (!IsLittleEndian())
+      {
+         auto p = (uint16_t*)buf;
+         for (int i=0, n=len/2; i<n; ++i)
+            p[i] = bswap16(p[i]);
+      }
+      break;
+   case Pcm24:
+      if (!IsLittleEndian())
+      {
+         auto p = (unsigned char*)buf;
+         for (int n=len/3; n--; p += 3)
+         {
+            auto t = p[0];
+            p[0] = p[2];
+            p[2] = t;
+         }
+      }
+      break;
+   case Pcm24Pad:
+      {
+         auto p = (int32_t*)buf;
+         if (IsLittleEndian())
+         {
+            for (int i=0, n=len/4; i<n; ++i)
+               p[i] >>= 8;
+         }
+         else
+         {
+            for (int i=0, n=len/4; i<n; ++i)
+               p[i] = (int32_t)bswap32(p[i]) >> 8;
+         }
+      }
+      break;
+   case PcmFloat:
+      if (!IsLittleEndian())
+      {
+         auto p = (uint32_t*)buf;
+         for (int i=0, n=len/4; i<n; ++i)
+            p[i] = bswap32(p[i]);
+      }
+      break;
+   }
 }
 
 class WavSource : public Source
@@ -115,6 +173,11 @@ public:
       {
          0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71
       };
+      static const unsigned char FloatGuid[] =
+      {
+         0x03,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71
+      };
+      bool isFloat = false;
 
       offsetToHeader = stream->GetPosition(err);
 
@@ -156,6 +219,9 @@ public:
       {
       case 1:      // PCM
          break;
+      case 3:      // IEEE float
+         isFloat = true;
+         break;
       case 0xfffe: // WAVE_FORMAT_EXTENSIBLE
 
          if (read32(&header.FormatHeaderSize) < sizeof(header.FormatHeader) + sizeof(ExtensibleHeader))
@@ -188,6 +254,11 @@ public:
 
          if (sizeof(PcmGuid) == sizeof(extHeader.Guid) && !memcmp(extHeader.Guid, PcmGuid, sizeof(PcmGuid)))
             break;
+         if (sizeof(FloatGuid) == sizeof(extHeader.Guid) && !memcmp(extHeader.Guid, FloatGuid, sizeof(FloatGuid)))
+         {
+            isFloat = true;
+            break;
+         }
       default:
          ERROR_SET(err, unknown, "Only PCM supported");
       }
@@ -200,10 +271,19 @@ public:
       case 24:
          metadata.Format = Pcm24;
          break;
+      case 32:
+         // There's no 32-bit integer format downstream, so keep the top
+         // 24 bits.  That is all most such files have anyway.
+         //
+         metadata.Format = isFloat ? PcmFloat : Pcm24Pad;
+         break;
       default:
          ERROR_SET(err, unknown, "Sorry - unsupported bits per sample");
       }
 
+      if (isFloat && metadata.Format != PcmFloat)
+         ERROR_SET(err, unknown, "Sorry - unsupported bits per sample");
+
       metadata.Channels = read16(&fmt.Channels);
       metadata.SampleRate = read32(&fmt.SampleRate);
       metadata.SamplesPerFrame = 0;
@@ -218,36 +298,31 @@ public:
 
    int Read(void *buf, int len, error *err)
    {
-      auto r = stream->Read(buf, len, err);
-      if (!ERROR_FAILED(err))
+      const int frameSize = metadata.Channels * GetBitsPerSample(metadata.Format)/8;
+      int r = 0;
+
+      // Samples go straight from the stream into the caller's buffer.
+      // Only ask for whole frames, and keep going after a short read,
+      // so the conversion never sees a partial sample.  Less than one
+      // frame would come back as 0, which means end of file.
+      //
+      if (len < frameSize)
+         ERROR_SET(err, unknown, "Buffer too small for one sample");
+
+      len -= len % frameSize;
+
+      while (r < len)
       {
-         switch (metadata.Format)
-         {
-         case PcmShort:
-            {
-               auto p = (uint16_t*)buf;
-               for (auto n = r/2; n--; ++p)
-                  *p = read16(p);
-            }
-            break;
-         case Pcm24:
-            {
-               auto p = (unsigned char *)buf;
-               auto n = r;
-
-               while (n)
-               {
-                  uint32_t i = read24(p);
-                  write24ne(p, i);
-                  p += 3;
-                  n -= 3;
-               }
-            }
+         int n = stream->Read((char*)buf + r, len - r, err);
+         ERROR_CHECK(err);
+         if (!n)
             break;
-         default:
-            ERROR_SET(err, unknown, "unexpected format");
-         }
+         r += n;
       }
+
+      r -= r % frameSize;
+
+      ToNative(metadata.Format, buf, r);
    exit:
       return r;
    }
@@ -303,6 +378,7 @@ public:
 struct WavCodec : public Codec
 {
    int GetBytesRequiredForDetection() { return sizeof(WavHeader); }
+   FileType GetFileType() { return FileTypeWav; }
 
    void TryOpen(
       common::Stream *file,
@@ -7,36 +7,41 @@
 */
 
 #include <MicroCodec.h>
-#include "codecs/seekbase.h"
+#include "codecs/carryover.h"
 #include <common/c++/new.h>
 #include <common/misc.h>
-#include <vector>
+#include <string.h>
 
 using namespace audio;
 
 namespace {
 
-class UCSource : public Source, public SeekBase
+class UCSource : public Source
 {
    common::Pointer<MicroCodec> uc;
-   common::Pointer<common::Stream> stream;
-   MicroCodecDemux lastHeader;
+   common::Pointer<PacketDemuxer> demux;
+   Packet packet;
+   CarryOver carryOver;
+   Metadata md;
+   bool decodedFirstFrame;
    bool eof;
-   uint64_t startOfData;
    uint64_t currentPos;
-   std::vector<unsigned char> readBuffer;
+   uint64_t duration;
+   int frameBytes;
 
 public:
 
-   UCSource(MicroCodec *uc_, common::Stream *stream_, uint64_t duration) :
-      SeekBase(duration),
+   UCSource(MicroCodec *uc_, PacketDemuxer *demux_, uint64_t duration_) :
       uc(uc_),
-      stream(stream_),
+      demux(demux_),
+      decodedFirstFrame(false),
       eof(false),
-      startOfData(0),
-      currentPos(0)
+      currentPos(0),
+      duration(duration_),
+      frameBytes(0)
    {
       ContainerHasSlowSeek = true;
+      memset(&packet, 0, sizeof(packet));
    }
 
    const char *
@@ -48,11 +53,10 @@ public:
    void
    Initialize(error *err)
    {
-      startOfData = stream->GetPosition(err);
+      uc->GetMetadata(&md, err);
       ERROR_CHECK(err);
 
-      ReadHeader(err);
-      ERROR_CHECK(err);
+      frameBytes = md.SamplesPerFrame * md.Channels * GetBitsPerSample(md.Format) / 8;
    exit:;
    }
 
@@ -66,77 +70,96 @@ public:
    Read(void *buf, int len, error *err)
    {
       int r = 0;
+      int n = 0;
 
-      if (!len || eof)
-         goto exit;
-
-      if (readBuffer.size() < lastHeader.FrameSize)
+      if (!carryOver.Empty())
       {
-         uint64_t sz = lastHeader.FrameSize;
-         const unsigned int align = 1024;
-         sz = MIN((sz + align - 1) / align * align, (1ULL<<32)-1);
-         try
-         {
-            readBuffer.resize(sz);
-         }
-         catch (const std::bad_alloc&)
-         {
-            ERROR_SET(err, nomem);
-         }
+         r = carryOver.Drain(buf, len);
+         if (!carryOver.Empty())
+            goto exit;
       }
 
-      r = stream->Read(readBuffer.data(), lastHeader.FrameSize, err);
-      ERROR_CHECK(err);
-      if (!r)
+      // Decode as many whole frames as fit in the caller's buffer.
+      // Not the first, which may change the format; see below.
+      //
+      while (decodedFirstFrame && len && len >= frameBytes && ReadPacket(err))
       {
-         eof = true;
-         goto exit;
+         n = Decode(buf, len, err);
+         ERROR_CHECK(err);
+         buf = (char*)buf + n;
+         len -= n;
+         r += n;
       }
-      if (r < lastHeader.FrameSize)
-         ERROR_SET(err, unknown, "Short read");
-
-      r = uc->Decode(
-         readBuffer.data(),
-         r,
-         buf,
-         len,
-         err
-      );
       ERROR_CHECK(err);
 
-      currentPos += GetDuration(lastHeader);
+      // Less than a frame of room, or the first frame, and nothing to
+      // return yet.
+      //
+      if (!r && len && ReadPacket(err))
+      {
+         void *p = carryOver.Prepare(frameBytes, packet.Duration, err);
+         ERROR_CHECK(err);
+         n = Decode(p, frameBytes, err);
+         ERROR_CHECK(err);
+         carryOver.SetLength(n);
+
+         // Some codecs only find the real format in the first frame,
+         // e.g. AAC with implicit SBR.  Have the caller re-negotiate
+         // before handing any of it out.
+         //
+         if (!decodedFirstFrame)
+         {
+            decodedFirstFrame = true;
+            if (CheckMetadataChanged(err))
+               goto exit;
+            ERROR_CHECK(err);
+         }
 
-      ReadHeader(err);
+         r = carryOver.Drain(buf, len);
+      }
       ERROR_CHECK(err);
    exit:
-      if (ERROR_FAILED(err)) { eof = true; error_clear(err); r = 0; }
+      // A bad packet ends the stream, but frames already decoded into
+      // @buf still go out; eof makes the next call return 0.  Anything
+      // in carryOver is from the failed decode.
+      //
+      if (ERROR_FAILED(err))
+      {
+         eof = true;
+         carryOver.Clear();
+         error_clear(err);
+      }
       return r;
    }
 
    void
    Seek(uint64_t pos, error *err)
    {
-      SeekBase::Seek(pos, err);
+      carryOver.Clear();
+      eof = false;
+      demux->SeekPacket(pos, currentPos, err);
    }
 
    uint64_t
    GetPosition(error *err)
    {
-      return GetPosition();
+      return currentPos - carryOver.GetRemainingDuration();
    }
 
    uint64_t
    GetDuration(error *err)
    {
-      return SeekBase::GetDuration(err);
+      if (!duration)
+         duration = demux->GetDuration(err);
+      return duration;
    }
 
    void
    GetStreamInfo(audio::StreamInfo *info, error *err)
    {
-      info->DurationKnown = SeekBase::GetDurationKnown();
+      info->DurationKnown = (duration != 0);
 
-      stream->GetStreamInfo(&info->FileStreamInfo, err);
+      demux->GetStreamInfo(&info->FileStreamInfo, err);
       ERROR_CHECK(err);
 
       Source::GetStreamInfo(info, err);
@@ -146,86 +169,43 @@ public:
 
 private:
 
-   void
-   ReadHeader(error *err)
+   bool
+   CheckMetadataChanged(error *err)
    {
-      int r = 0;
+      Metadata newMd;
 
-      r = stream->Read(&lastHeader, sizeof(lastHeader), err);
+      uc->GetMetadata(&newMd, err);
       ERROR_CHECK(err);
-      if (r != sizeof(lastHeader))
+
+      if (newMd.Format != md.Format ||
+          newMd.Channels != md.Channels ||
+          newMd.SampleRate != md.SampleRate)
       {
-         eof = true;
-         goto exit;
+         MetadataChanged = true;
       }
-   exit:;
-   }
-
-   uint64_t
-   GetDuration(const MicroCodecDemux &header)
-   {
-      return header.Duration;
-   }
-
-protected:
-
-   //
-   // SeekBase methods
-   //
-
-   uint64_t
-   GetPosition(void)
-   {
-      return currentPos;
+      md = newMd;
+      frameBytes = md.SamplesPerFrame * md.Channels * GetBitsPerSample(md.Format) / 8;
+   exit:
+      return MetadataChanged;
    }
 
-   uint64_t
-   GetNextDuration(void)
+   bool
+   ReadPacket(error *err)
    {
-      return eof ? 0 : GetDuration(lastHeader);
+      if (!eof && !demux->ReadPacket(packet, err))
+         eof = true;
+      return !eof && !ERROR_FAILED(err);
    }
 
-   void
-   SeekToOffset(uint64_t off, uint64_t time, error *err)
+   int
+   Decode(void *buf, int len, error *err)
    {
-      currentPos = time;
-      eof = false;
-
-      stream->Seek(startOfData + off, SEEK_SET, err);
+      int r = uc->Decode(packet.Data, packet.Size, buf, len, err);
       ERROR_CHECK(err);
 
-      ReadHeader(err);
-      ERROR_CHECK(err);
-   exit:;
-   }
-
-   void
-   SkipFrame(error *err)
-   {
-      if (!eof)
-      {
-         stream->Seek(
-            lastHeader.FrameSize,
-            SEEK_CUR,
-            err
-         );
-         ERROR_CHECK(err);
-
-         currentPos += GetDuration(lastHeader);
-
-         ReadHeader(err);
-         ERROR_CHECK(err);
-      }
-   exit:;
-   }
-
-   void
-   CapturePosition(RollbackBase **rollback, error *err)
-   {
-      *rollback = CreateRollbackWithCursorPos(
-         stream.Get(), err,
-         currentPos, eof, lastHeader, MetadataChanged
-      );
+      currentPos = packet.Timestamp + packet.Duration;
+   exit:
+      return r;
    }
 };
 
@@ -234,7 +214,7 @@ protected:
 void
 audio::AudioSourceFromMicroCodec(
    audio::MicroCodec *codec,
-   common::Stream *demuxer,
+   PacketDemuxer *demuxer,
    uint64_t duration,
    const void *config,
    int nbytes,
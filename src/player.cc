@@ -21,6 +21,8 @@
 #include <errno.h>
 #include <math.h>
 
+#include <atomic>
+
 #include <tools/kiss_fftr.h>
 
 using namespace common;
@@ -63,6 +65,18 @@ struct PlayerVisState
       if (cpx) delete[] cpx;
    }
 };
+
+// The latest duration a source has sent through DurationRefined.  The
+// subscription holds a reference, so it stays valid if the source
+// outlives the player.
+//
+struct PlayerDurationState
+{
+   std::atomic<bool> Known;
+   std::atomic<uint64_t> Duration;
+
+   PlayerDurationState() : Known(false), Duration(0) {}
+};
 } // end namespace
 
 audio::Player::Player()
@@ -170,19 +184,36 @@ audio::Player::NegotiateMetadata(error *err)
 {
    int newBufsz;
    int suggested;
+   Metadata sourceMd;
    Metadata targetMd;
    const Format *formats = nullptr;
    int nFormats = 0;
    Format suggestedFormat;
-   bool formatFound = false;
-   int interestingFormats[] = { -1, -1, -1 };
+   bool formatFound;
+   int interestingFormats[3];
+   bool askedForFloat = false;
+
+   // If we are about to convert the codec's output to float, see if the
+   // codec can give us float to begin with.  Besides saving a conversion,
+   // some codecs have more than 16 bits of precision to offer.
+   //
+   auto trySourceFormat = [&] (Format fmt, error *err) -> bool
+   {
+      if (fmt != PcmFloat || md.Format == PcmFloat || askedForFloat)
+         return false;
+      askedForFloat = true;
+      return source->SetFormat(fmt, err);
+   };
 
+retry:
    // Retrieve codec's native format.
    //
    source->GetMetadata(&md, err);
    ERROR_CHECK(err);
 
-   LogMetadata(md, source->Describe());
+   // Logged below, once we are done asking the codec for other formats.
+   //
+   sourceMd = md;
 
    // Default packet size of 20ms if not set by codec.
    //
@@ -223,6 +254,12 @@ audio::Player::NegotiateMetadata(error *err)
 
       if (targetMd.Format != desiredFmt)
       {
+         if (trySourceFormat(desiredFmt, err) || ERROR_FAILED(err))
+         {
+            ERROR_CHECK(err);
+            goto retry;
+         }
+
          log_printf("Converting to %s for resampler", GetFormatName(desiredFmt));
 
          transforms.AddFormatConversion(targetMd, desiredFmt, err);
@@ -241,6 +278,12 @@ audio::Player::NegotiateMetadata(error *err)
    if (!nFormats)
       ERROR_SET(err, unknown, "No supported formats");
 
+   // Starts over if we came back from retry with a new source format.
+   //
+   formatFound = false;
+   for (int i=0; i<ARRAY_SIZE(interestingFormats); ++i)
+      interestingFormats[i] = -1;
+
    for (int i=0; !formatFound && i<nFormats; ++i)
    {
       int tB = 0, cB = 0, c2B = 0, c3B;
@@ -286,12 +329,20 @@ audio::Player::NegotiateMetadata(error *err)
 
    if (targetMd.Format != suggestedFormat)
    {
+      if (trySourceFormat(suggestedFormat, err) || ERROR_FAILED(err))
+      {
+         ERROR_CHECK(err);
+         goto retry;
+      }
+
       log_printf("Converting to %s for audio device", GetFormatName(suggestedFormat));
 
       transforms.AddFormatConversion(targetMd, suggestedFormat, err);
       ERROR_CHECK(err);
    }
 
+   LogMetadata(sourceMd, source->Describe());
+
    dev->SetMetadata(targetMd, err);
    ERROR_CHECK(err);
 
@@ -633,8 +684,35 @@ void
 audio::Player::SetSource(Source *src, error *err)
 {
    this->source = src;
+   durationState.reset();
    if (src)
    {
+      std::shared_ptr<PlayerDurationState> state;
+
+      try
+      {
+         state = std::make_shared<PlayerDurationState>();
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(err, nomem);
+      }
+
+      // Called from the source's scan thread.  Just keep the number, so
+      // TimeSync() never has to wait on the scan.
+      //
+      src->DurationRefined.Subscribe(
+         [state] (uint64_t &duration, error *err) -> void
+         {
+            state->Duration = duration;
+            state->Known = true;
+         },
+         err
+      );
+      ERROR_CHECK(err);
+
+      durationState = state;
+
       NegotiateMetadata(err);
       ERROR_CHECK(err);
       pos = src->GetPosition(err);
@@ -665,6 +743,8 @@ audio::Player::GetPosition(error *err)
 uint64_t
 audio::Player::GetDuration(error *err)
 {
+   if (durationState.get() && durationState->Known)
+      return durationState->Duration;
    return source.Get() ? source->GetDuration(err) : 0ULL;
 }
 
@@ -0,0 +1,133 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#include <AudioStream.h>
+
+#include <chrono>
+#include <new>
+#include <ratio>
+
+using namespace common;
+using namespace audio;
+
+namespace {
+
+// Same units as the rest of the library's times.
+//
+typedef std::chrono::duration<uint64_t, std::ratio<1, 10000000>> Ticks;
+
+class CountingStream : public Stream
+{
+   Pointer<Stream> inner;
+   std::shared_ptr<StreamStats> stats;
+
+   class Timer
+   {
+      uint64_t &total;
+      std::chrono::steady_clock::time_point start;
+
+   public:
+      Timer(uint64_t &total_) :
+         total(total_),
+         start(std::chrono::steady_clock::now())
+      {
+      }
+
+      ~Timer()
+      {
+         auto elapsed = std::chrono::steady_clock::now() - start;
+         total += std::chrono::duration_cast<Ticks>(elapsed).count();
+      }
+   };
+
+public:
+
+   CountingStream(Stream *inner_, const std::shared_ptr<StreamStats> &stats_) :
+      inner(inner_),
+      stats(stats_)
+   {
+   }
+
+   size_t
+   Read(void *buf, size_t len, error *err)
+   {
+      size_t r = 0;
+      int bucket = 0;
+
+      while (bucket < StreamStats::ReadSizeBuckets - 1 && (len >> (bucket + 1)))
+         ++bucket;
+
+      ++stats->Reads;
+      ++stats->ReadSizes[bucket];
+
+      {
+         Timer t(stats->TimeBlocked);
+         r = inner->Read(buf, len, err);
+      }
+
+      if (!ERROR_FAILED(err))
+         stats->BytesRead += r;
+
+      return r;
+   }
+
+   void
+   Seek(int64_t off, int whence, error *err)
+   {
+      ++stats->Seeks;
+
+      Timer t(stats->TimeBlocked);
+      inner->Seek(off, whence, err);
+   }
+
+   uint64_t
+   GetPosition(error *err)
+   {
+      return inner->GetPosition(err);
+   }
+
+   uint64_t
+   GetSize(error *err)
+   {
+      return inner->GetSize(err);
+   }
+
+   void
+   GetStreamInfo(common::StreamInfo *info, error *err)
+   {
+      inner->GetStreamInfo(info, err);
+   }
+};
+
+} // end namespace
+
+void
+audio::CreateCountingStream(
+   common::Stream *stream,
+   const std::shared_ptr<StreamStats> &stats,
+   common::Stream **out,
+   error *err
+)
+{
+   Pointer<CountingStream> r;
+
+   if (!stats.get())
+      ERROR_SET(err, unknown, "No StreamStats to count into");
+
+   try
+   {
+      *r.GetAddressOf() = new CountingStream(stream, stats);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+exit:
+   *out = r.Detach();
+}
@@ -0,0 +1,239 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#include <AudioStream.h>
+
+#include <common/misc.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <new>
+
+#if !defined(_WINDOWS)
+#define HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace common;
+
+#if defined(HAVE_MMAP)
+
+namespace {
+
+// How far ahead of the read position we ask the kernel to have pages in.
+//
+const uint64_t ReadAheadSize = 512 * 1024;
+
+class MappedStream : public Stream
+{
+   unsigned char *base;
+   uint64_t size;
+   uint64_t pos;
+
+   // End of the last range we passed to posix_madvise(WILLNEED).
+   //
+   uint64_t advised;
+
+   void
+   ReadAhead(void)
+   {
+      uint64_t start = pos & ~(uint64_t)(ReadAheadSize - 1);
+      uint64_t end = MIN(size, start + 2 * ReadAheadSize);
+
+      // Once per ReadAheadSize of sequential reading, or after a seek.
+      //
+      if (pos < advised && advised - pos >= ReadAheadSize)
+         return;
+      if (start >= end)
+         return;
+
+      // Only a hint, so failure doesn't matter.
+      //
+      posix_madvise(base + start, end - start, POSIX_MADV_WILLNEED);
+      advised = end;
+   }
+
+public:
+
+   MappedStream(void *base_, uint64_t size_) :
+      base((unsigned char*)base_),
+      size(size_),
+      pos(0),
+      advised(0)
+   {
+      posix_madvise(base, size, POSIX_MADV_SEQUENTIAL);
+      ReadAhead();
+   }
+
+   ~MappedStream()
+   {
+      munmap(base, size);
+   }
+
+   const void *
+   GetData(void) const
+   {
+      return base;
+   }
+
+   size_t
+   Read(void *buf, size_t len, error *err)
+   {
+      size_t r = 0;
+
+      if (pos < size)
+      {
+         r = MIN(len, size - pos);
+         memcpy(buf, base + pos, r);
+         pos += r;
+         ReadAhead();
+      }
+
+      return r;
+   }
+
+   void
+   Seek(int64_t off, int whence, error *err)
+   {
+      switch (whence)
+      {
+      case SEEK_SET:
+         break;
+      case SEEK_CUR:
+         off += pos;
+         break;
+      case SEEK_END:
+         off += size;
+         break;
+      default:
+         ERROR_SET(err, unknown, "Bad seek whence");
+      }
+
+      if (off < 0)
+         ERROR_SET(err, unknown, "Seek to negative position");
+
+      if (pos != (uint64_t)off)
+      {
+         pos = off;
+         advised = 0;
+         ReadAhead();
+      }
+   exit:;
+   }
+
+   uint64_t
+   GetPosition(error *err)
+   {
+      return pos;
+   }
+
+   uint64_t
+   GetSize(error *err)
+   {
+      return size;
+   }
+
+   void
+   GetStreamInfo(common::StreamInfo *info, error *err)
+   {
+      *info = common::StreamInfo();
+      info->FileSizeKnown = true;
+   }
+};
+
+// Returns false, and leaves @f alone, if it's not something we can map.
+//
+bool
+TryMapFile(FILE *f, Pointer<MappedStream> &r, error *err)
+{
+   struct stat st;
+   void *p = MAP_FAILED;
+
+   // Pipes, ttys and the like get stdio, as do empty files, which
+   // mmap() refuses.  So do files that don't fit in the address space.
+   //
+   if (fstat(fileno(f), &st) || !S_ISREG(st.st_mode) || st.st_size <= 0)
+      goto exit;
+   if ((uint64_t)st.st_size > SIZE_MAX)
+      goto exit;
+
+   p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fileno(f), 0);
+   if (p == MAP_FAILED)
+      goto exit;
+
+   try
+   {
+      *r.GetAddressOf() = new MappedStream(p, st.st_size);
+   }
+   catch (const std::bad_alloc&)
+   {
+      munmap(p, st.st_size);
+      ERROR_SET(err, nomem);
+   }
+
+exit:
+   return r.Get() != nullptr;
+}
+
+} // end namespace
+
+#endif
+
+void
+audio::CreateFileStream(
+   FILE *f,
+   common::Stream **out,
+   StreamMapping *mapping,
+   error *err
+)
+{
+   Pointer<Stream> r;
+
+   if (mapping)
+      *mapping = StreamMapping();
+
+#if defined(HAVE_MMAP)
+   {
+      Pointer<MappedStream> mapped;
+
+      if (TryMapFile(f, mapped, err))
+      {
+         // The mapping keeps its own reference to the file.
+         //
+         fclose(f);
+         f = nullptr;
+
+         if (mapping)
+         {
+            mapping->Data = mapped->GetData();
+            mapping->Size = mapped->GetSize(err);
+         }
+
+         r = mapped.Get();
+      }
+      ERROR_CHECK(err);
+   }
+#endif
+
+   if (!r.Get())
+   {
+      CreateStream(f, r.GetAddressOf(), err);
+      ERROR_CHECK(err);
+   }
+
+exit:
+   if (ERROR_FAILED(err))
+   {
+      r = nullptr;
+      if (mapping)
+         *mapping = StreamMapping();
+   }
+   *out = r.Detach();
+}
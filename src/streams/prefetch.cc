@@ -0,0 +1,411 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+#include <AudioStream.h>
+
+#include <common/misc.h>
+#include <common/c++/new.h>
+#include <common/c++/worker.h>
+
+#include <string.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace common;
+
+namespace {
+
+const size_t ChunkSize = 64 * 1024;
+const size_t DefaultWindowSize = 1024 * 1024;
+
+class PrefetchStream : public Stream
+{
+   struct Chunk
+   {
+      uint64_t Offset;
+      std::vector<unsigned char> Data;
+
+      uint64_t End(void) const { return Offset + Data.size(); }
+   };
+
+   Pointer<Stream> inner;
+   size_t windowSize;
+   common::StreamInfo info;
+   uint64_t size;
+   bool sizeKnown;
+
+   std::mutex lock;
+   std::condition_variable cond;
+   std::unique_ptr<WorkerThread> thread;
+
+   // The rest is guarded by lock.
+   //
+   // chunks covers [chunks.front().Offset, fillPos) with no gaps.  The
+   // chunk before the one we're reading from is kept around, so that a
+   // codec stepping back a little doesn't throw the window away.
+   //
+   std::deque<Chunk> chunks;
+   std::vector<std::vector<unsigned char>> spare;
+   uint64_t pos;
+   uint64_t fillPos;
+   uint64_t generation;
+   bool eof;
+   bool stopping;
+
+   // If the fill thread gets an error, it stops, and reads go to the
+   // inner stream directly (with lock held) until a seek, so that the
+   // caller sees the real error.
+   //
+   bool failed;
+
+   uint64_t
+   Buffered(void) const
+   {
+      return fillPos > pos ? fillPos - pos : 0;
+   }
+
+   void
+   Recycle(std::vector<unsigned char> &data)
+   {
+      try
+      {
+         spare.push_back(std::move(data));
+      }
+      catch (const std::bad_alloc&)
+      {
+      }
+   }
+
+   void
+   Restart(uint64_t off)
+   {
+      while (chunks.size())
+      {
+         Recycle(chunks.front().Data);
+         chunks.pop_front();
+      }
+
+      ++generation;
+      fillPos = off;
+      eof = false;
+      failed = false;
+      cond.notify_all();
+   }
+
+   void
+   Fill(void)
+   {
+      std::unique_lock<std::mutex> l(lock);
+      uint64_t innerPos = fillPos;
+
+      for (;;)
+      {
+         std::vector<unsigned char> data;
+         uint64_t off = 0, gen = 0;
+         size_t n = 0;
+         error err;
+
+         cond.wait(
+            l,
+            [this] () -> bool
+            {
+               return stopping || (!eof && !failed && Buffered() < windowSize);
+            }
+         );
+         if (stopping)
+            break;
+
+         off = fillPos;
+         gen = generation;
+         if (spare.size())
+         {
+            data = std::move(spare.back());
+            spare.pop_back();
+         }
+
+         l.unlock();
+
+         try
+         {
+            data.resize(ChunkSize);
+         }
+         catch (const std::bad_alloc&)
+         {
+            ERROR_SET(&err, nomem);
+         }
+
+         if (innerPos != off)
+         {
+            inner->Seek(off, SEEK_SET, &err);
+            ERROR_CHECK(&err);
+            innerPos = off;
+         }
+
+         n = inner->Read(data.data(), data.size(), &err);
+         ERROR_CHECK(&err);
+         innerPos += n;
+
+      exit:
+         l.lock();
+
+         if (gen != generation)
+         {
+            // A seek went somewhere else while we were reading.
+            //
+            Recycle(data);
+            continue;
+         }
+
+         if (ERROR_FAILED(&err))
+         {
+            failed = true;
+            innerPos = ~0ULL;
+         }
+         else if (!n)
+         {
+            eof = true;
+         }
+         else
+         {
+            data.resize(n);
+
+            try
+            {
+               chunks.push_back({off, std::move(data)});
+               fillPos += n;
+            }
+            catch (const std::bad_alloc&)
+            {
+               failed = true;
+            }
+         }
+
+         cond.notify_all();
+      }
+   }
+
+   // Called with lock held, after the fill thread has failed.
+   //
+   size_t
+   ReadDirect(void *buf, size_t len, error *err)
+   {
+      size_t r = 0;
+
+      inner->Seek(pos, SEEK_SET, err);
+      ERROR_CHECK(err);
+
+      r = inner->Read(buf, len, err);
+      ERROR_CHECK(err);
+
+      pos += r;
+   exit:
+      return r;
+   }
+
+public:
+
+   PrefetchStream(Stream *inner_, size_t windowSize_) :
+      inner(inner_),
+      windowSize(windowSize_ ? windowSize_ : DefaultWindowSize),
+      size(0),
+      sizeKnown(false),
+      pos(0),
+      fillPos(0),
+      generation(0),
+      eof(false),
+      stopping(false),
+      failed(false)
+   {
+   }
+
+   ~PrefetchStream()
+   {
+      if (thread.get())
+      {
+         {
+            std::lock_guard<std::mutex> l(lock);
+            stopping = true;
+            cond.notify_all();
+         }
+         thread.reset();
+      }
+   }
+
+   void
+   Initialize(error *err)
+   {
+      // Anything we need from the inner stream outside the fill thread,
+      // get it now.
+      //
+      inner->GetStreamInfo(&info, err);
+      ERROR_CHECK(err);
+
+      if (info.FileSizeKnown)
+      {
+         size = inner->GetSize(err);
+         ERROR_CHECK(err);
+         sizeKnown = true;
+      }
+
+      pos = fillPos = inner->GetPosition(err);
+      ERROR_CHECK(err);
+
+      New(thread, err);
+      ERROR_CHECK(err);
+
+      thread->Schedule(
+         [this] (error *err) -> void
+         {
+            Fill();
+         }
+      );
+   exit:;
+   }
+
+   size_t
+   Read(void *buf, size_t len, error *err)
+   {
+      std::unique_lock<std::mutex> l(lock);
+      unsigned char *p = (unsigned char*)buf;
+      size_t r = 0;
+
+      while (r < len)
+      {
+         while (chunks.size() >= 2 && chunks[1].End() <= pos)
+         {
+            Recycle(chunks.front().Data);
+            chunks.pop_front();
+         }
+
+         auto q = chunks.begin();
+         while (q != chunks.end() && q->End() <= pos)
+            ++q;
+
+         if (q != chunks.end() && q->Offset <= pos)
+         {
+            size_t n = MIN(len - r, (size_t)(q->End() - pos));
+            memcpy(p + r, q->Data.data() + (pos - q->Offset), n);
+            pos += n;
+            r += n;
+
+            // There may be room for more now.
+            //
+            cond.notify_all();
+            continue;
+         }
+
+         if (failed)
+         {
+            r += ReadDirect(p + r, len - r, err);
+            break;
+         }
+
+         if (eof && fillPos <= pos)
+            break;
+
+         cond.wait(l);
+      }
+
+      return r;
+   }
+
+   void
+   Seek(int64_t off, int whence, error *err)
+   {
+      std::lock_guard<std::mutex> l(lock);
+
+      switch (whence)
+      {
+      case SEEK_SET:
+         break;
+      case SEEK_CUR:
+         off += pos;
+         break;
+      case SEEK_END:
+         if (!sizeKnown)
+            ERROR_SET(err, unknown, "Seek from end of a stream of unknown size");
+         off += size;
+         break;
+      default:
+         ERROR_SET(err, unknown, "Bad seek whence");
+      }
+
+      if (off < 0)
+         ERROR_SET(err, unknown, "Seek to negative position");
+
+      pos = off;
+
+      if (chunks.size() ? (pos < chunks.front().Offset || pos > fillPos)
+                        : (pos != fillPos))
+      {
+         Restart(pos);
+      }
+      else if (failed)
+      {
+         failed = false;
+         cond.notify_all();
+      }
+   exit:;
+   }
+
+   uint64_t
+   GetPosition(error *err)
+   {
+      std::lock_guard<std::mutex> l(lock);
+      return pos;
+   }
+
+   uint64_t
+   GetSize(error *err)
+   {
+      if (!sizeKnown)
+         ERROR_SET(err, unknown, "Stream size unknown");
+   exit:
+      return size;
+   }
+
+   void
+   GetStreamInfo(common::StreamInfo *info, error *err)
+   {
+      *info = this->info;
+   }
+};
+
+} // end namespace
+
+void
+audio::CreatePrefetchStream(
+   common::Stream *stream,
+   size_t windowSize,
+   common::Stream **out,
+   error *err
+)
+{
+   Pointer<PrefetchStream> r;
+
+   try
+   {
+      *r.GetAddressOf() = new PrefetchStream(stream, windowSize);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(err, nomem);
+   }
+
+   r->Initialize(err);
+   ERROR_CHECK(err);
+
+exit:
+   if (ERROR_FAILED(err))
+      r = nullptr;
+   *out = r.Detach();
+}
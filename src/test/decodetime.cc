@@ -0,0 +1,130 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+//
+// Decodes each file given on the command line from start to finish a few
+// times, and prints the fastest run next to the length of the audio.
+// Files are mapped where possible, and the first run warms the page
+// cache, so the best run is mostly decoder time.  For comparing builds
+// of a codec, eg. with and without its SIMD paths.
+//
+
+#include <AudioCodec.h>
+#include <AudioStream.h>
+#include <common/logger.h>
+#include <stdio.h>
+#include <errno.h>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+const int Runs = 5;
+
+} // end namespace
+
+#if defined(_WINDOWS)
+int wmain(int argc, wchar_t **argv)
+#else
+int main(int argc, char **argv)
+#endif
+{
+   log_register_callback(
+      [] (void *np, const char *p) -> void { fputs(p, stderr); },
+      nullptr
+   );
+   error err;
+   FILE *f = nullptr;
+   auto files = argv + 1;
+   std::vector<unsigned char> buf;
+
+   if (!*files)
+      ERROR_SET(&err, unknown, "Usage: decodetime file [file2 ...]");
+
+   audio::RegisterCodecs();
+
+   try
+   {
+      buf.resize(64 * 1024);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(&err, nomem);
+   }
+
+   while (*files)
+   {
+      auto filename = *files++;
+      common::Pointer<common::Stream> file;
+      common::Pointer<audio::Source> src;
+      audio::CodecArgs args;
+      double best = 0, length = 0;
+
+#if defined(_WINDOWS)
+      f = _wfopen(filename, L"rb");
+      printf("%ls (", filename);
+#else
+      f = fopen(filename, "rb");
+      printf("%s (", filename);
+#endif
+      if (!f) ERROR_SET(&err, errno, errno);
+
+      audio::CreateFileStream(f, file.GetAddressOf(), &args.Mapping, &err);
+      ERROR_CHECK(&err);
+
+      f = nullptr;
+
+      audio::OpenCodec(file.Get(), &args, src.GetAddressOf(), &err);
+      ERROR_CHECK(&err);
+
+      printf("%s)\n", src->Describe() ? src->Describe() : "?");
+
+      for (int i=0; i<Runs; ++i)
+      {
+         double elapsed = 0;
+
+         if (i)
+         {
+            src->Seek(0, &err);
+            ERROR_CHECK(&err);
+         }
+
+         auto start = std::chrono::steady_clock::now();
+
+         for (;;)
+         {
+            int n = src->Read(buf.data(), buf.size(), &err);
+            ERROR_CHECK(&err);
+            if (!n)
+               break;
+         }
+
+         elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+         ).count();
+
+         if (!i || elapsed < best)
+            best = elapsed;
+
+         length = src->GetPosition(&err) / 10000000.0;
+         ERROR_CHECK(&err);
+      }
+
+      printf(
+         "  %.3f s of audio, best of %d: %.3f s decode, %.1fx realtime\n",
+         length,
+         Runs,
+         best,
+         best > 0 ? length / best : 0.0
+      );
+   }
+
+exit:
+   if (f) fclose(f);
+   return ERROR_FAILED(&err) ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/*
+ Copyright (C) 2026 Andrew Sveikauskas
+
+ Permission to use, copy, modify, and distribute this software for any
+ purpose with or without fee is hereby granted, provided that the above
+ copyright notice and this permission notice appear in all copies.
+*/
+
+//
+// Opens, decodes and seeks each file given on the command line through a
+// counting stream, and prints how much I/O each part took.  Files are
+// read with stdio rather than mapped, so that reads and seeks here stand
+// for system calls.
+//
+
+#define __STDC_FORMAT_MACROS 1
+
+#include <AudioCodec.h>
+#include <AudioStream.h>
+#include <common/logger.h>
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <vector>
+
+#if defined(_WINDOWS) && !defined(PRIu64)
+#define PRIu64 "I64u"
+#endif
+
+namespace {
+
+const int SeekCount = 10;
+
+void
+Report(const char *phase, const audio::StreamStats &stats, const char *per, double n)
+{
+   printf(
+      "  %-8s %8" PRIu64 " reads %8" PRIu64 " seeks %10" PRIu64 " bytes %8.2f ms blocked",
+      phase,
+      stats.Reads,
+      stats.Seeks,
+      stats.BytesRead,
+      stats.TimeBlocked / 10000.0
+   );
+   if (n > 0)
+   {
+      printf(
+         "   %.2f reads, %.2f seeks per %s",
+         stats.Reads / n,
+         stats.Seeks / n,
+         per
+      );
+   }
+   printf("\n");
+}
+
+void
+ReportReadSizes(const audio::StreamStats &stats)
+{
+   printf("  read sizes:\n");
+   for (int i=0; i<audio::StreamStats::ReadSizeBuckets; ++i)
+   {
+      if (!stats.ReadSizes[i])
+         continue;
+      printf(
+         "    %s%8lu bytes: %" PRIu64 "\n",
+         (i == audio::StreamStats::ReadSizeBuckets - 1) ? ">=" : "  ",
+         1UL << i,
+         stats.ReadSizes[i]
+      );
+   }
+}
+
+} // end namespace
+
+#if defined(_WINDOWS)
+int wmain(int argc, wchar_t **argv)
+#else
+int main(int argc, char **argv)
+#endif
+{
+   log_register_callback(
+      [] (void *np, const char *p) -> void { fputs(p, stderr); },
+      nullptr
+   );
+   error err;
+   FILE *f = nullptr;
+   auto files = argv + 1;
+   std::vector<unsigned char> buf;
+
+   if (!*files)
+      ERROR_SET(&err, unknown, "Usage: iostats file [file2 ...]");
+
+   audio::RegisterCodecs();
+
+   try
+   {
+      buf.resize(64 * 1024);
+   }
+   catch (const std::bad_alloc&)
+   {
+      ERROR_SET(&err, nomem);
+   }
+
+   while (*files)
+   {
+      auto filename = *files++;
+      common::Pointer<common::Stream> file, counted;
+      common::Pointer<audio::Source> src;
+      std::shared_ptr<audio::StreamStats> stats;
+      uint64_t duration = 0, decoded = 0;
+      audio::CodecArgs args;
+
+#if defined(_WINDOWS)
+      f = _wfopen(filename, L"rb");
+      printf("%ls (", filename);
+#else
+      f = fopen(filename, "rb");
+      printf("%s (", filename);
+#endif
+      if (!f) ERROR_SET(&err, errno, errno);
+
+      common::CreateStream(f, file.GetAddressOf(), &err);
+      ERROR_CHECK(&err);
+
+      f = nullptr;
+
+      try
+      {
+         stats = std::make_shared<audio::StreamStats>();
+      }
+      catch (const std::bad_alloc&)
+      {
+         ERROR_SET(&err, nomem);
+      }
+
+      audio::CreateCountingStream(file.Get(), stats, counted.GetAddressOf(), &err);
+      ERROR_CHECK(&err);
+
+      audio::OpenCodec(counted.Get(), &args, src.GetAddressOf(), &err);
+      ERROR_CHECK(&err);
+
+      printf("%s)\n", src->Describe() ? src->Describe() : "?");
+
+      Report("open", *stats, nullptr, 0);
+      stats->Reset();
+
+      duration = src->GetDuration(&err);
+      ERROR_CHECK(&err);
+
+      Report("duration", *stats, nullptr, 0);
+      stats->Reset();
+
+      for (;;)
+      {
+         int n = src->Read(buf.data(), buf.size(), &err);
+         ERROR_CHECK(&err);
+         if (!n)
+            break;
+      }
+
+      decoded = src->GetPosition(&err);
+      ERROR_CHECK(&err);
+
+      Report("decode", *stats, "second", decoded / 10000000.0);
+      ReportReadSizes(*stats);
+      stats->Reset();
+
+      for (int i=0; duration && i<SeekCount; ++i)
+      {
+         // Spread out, and out of order, so no seek is a short hop
+         // from the one before.
+         //
+         uint64_t pos = duration / SeekCount * ((i * 7) % SeekCount);
+
+         src->Seek(pos, &err);
+         ERROR_CHECK(&err);
+
+         src->Read(buf.data(), buf.size(), &err);
+         ERROR_CHECK(&err);
+      }
+
+      Report("seek", *stats, "seek", duration ? SeekCount : 0);
+   }
+
+exit:
+   if (f) fclose(f);
+   return ERROR_FAILED(&err) ? 1 : 0;
+}
@@ -10,6 +10,7 @@
 
 #include <AudioCodec.h>
 #include <AudioPlayer.h>
+#include <AudioStream.h>
 #include <common/logger.h>
 #include <stdio.h>
 #include <string>
@@ -32,7 +33,7 @@ int main(int argc, char **argv)
       nullptr
    );
    error err;
-   common::Pointer<common::Stream> file;
+   common::Pointer<common::Stream> file, prefetch;
    common::Pointer<audio::Source> src;
    common::Pointer<audio::Player> player;
    FILE *f = nullptr;
@@ -81,13 +82,45 @@ int main(int argc, char **argv)
 #endif
       if (!f) ERROR_SET(&err, errno, errno);
 
-      common::CreateStream(f, file.GetAddressOf(), &err);
+      audio::CodecArgs args;
+      args.Metadata = &recv;
+
+      audio::CreateFileStream(f, file.GetAddressOf(), &args.Mapping, &err);
       ERROR_CHECK(&err); 
 
       f = nullptr;
 
-      audio::CodecArgs args;
-      args.Metadata = &recv;
+      // Keep file I/O off the thread that feeds the device.  A mapped
+      // file already has the kernel reading ahead.
+      //
+      if (!args.Mapping.Data)
+      {
+         audio::CreatePrefetchStream(file.Get(), 0, prefetch.GetAddressOf(), &err);
+         ERROR_CHECK(&err);
+
+         file = prefetch;
+         prefetch = nullptr;
+      }
+
+      // A second handle on the same file, so codecs that have to walk
+      // frames to find the duration can do it on their own thread rather
+      // than on the player's.  Without it we just wait for the walk.
+      //
+#if defined(_WINDOWS)
+      f = _wfopen(filename, L"rb");
+#else
+      f = fopen(filename, "rb");
+#endif
+      if (f)
+      {
+         audio::CreateFileStream(f, args.DurationStream.GetAddressOf(), nullptr, &err);
+         if (ERROR_FAILED(&err))
+         {
+            fclose(f);
+            error_clear(&err);
+         }
+         f = nullptr;
+      }
 
       audio::OpenCodec(file.Get(), &args, src.GetAddressOf(), &err);
       ERROR_CHECK(&err); 
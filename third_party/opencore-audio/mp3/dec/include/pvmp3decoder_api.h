@@ -223,6 +223,14 @@ extern "C"
 
         int16       *pOutputBuffer;
 
+        /*
+         * INPUT: (but what is pointed to is an output)
+         * If not NULL, PCM samples are stored here as floating point,
+         * interleaved the same way, and pOutputBuffer is not used.
+         */
+
+        float       *pOutputBufferFloat;
+
     }tPVMP3DecoderExternal;
 
 
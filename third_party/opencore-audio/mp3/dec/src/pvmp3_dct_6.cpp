@@ -79,13 +79,6 @@ Returns
 ; Include all pre-processor statements here. Include conditional
 ; compile variables also.
 ----------------------------------------------------------------------------*/
-#define Qfmt30(a)   (Int32)(a*((Int32)1<<30) + (a>=0?0.5F:-0.5F))
-
-#define cos_pi_6     Qfmt30(  0.86602540378444f)
-#define cos_2_pi_6   Qfmt30(  0.5f)
-#define cos_7_pi_12  Qfmt30( -0.25881904510252f)
-#define cos_3_pi_12  Qfmt30(  0.70710678118655f)
-#define cos_11_pi_12 Qfmt30( -0.96592582628907f)
 
 /*----------------------------------------------------------------------------
 ; LOCAL FUNCTION DEFINITIONS
@@ -132,7 +125,7 @@ void pvmp3_dct_6(int32 vec[])
     tmp3 =  vec[3] - vec[2];
 
     vec[0]  = tmp0 + tmp2 ;
-    vec[2]  = fxp_mul32_Q30(tmp0 - tmp2,   cos_pi_6);
+    vec[2]  = fxp_mul32_Q30(tmp0 - tmp2,   cos_pi_6_q30);
     vec[4]  = (vec[0] >> 1) - tmp1;
     vec[0] += tmp1;
 
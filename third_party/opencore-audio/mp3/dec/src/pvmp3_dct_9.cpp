@@ -77,21 +77,6 @@ Returns
 ; Include all pre-processor statements here. Include conditional
 ; compile variables also.
 ----------------------------------------------------------------------------*/
-#define Qfmt31(a)   (int32)(a*(0x7FFFFFFF))
-
-#define cos_pi_9    Qfmt31( 0.93969262078591f)
-#define cos_2pi_9   Qfmt31( 0.76604444311898f)
-#define cos_4pi_9   Qfmt31( 0.17364817766693f)
-#define cos_5pi_9   Qfmt31(-0.17364817766693f)
-#define cos_7pi_9   Qfmt31(-0.76604444311898f)
-#define cos_8pi_9   Qfmt31(-0.93969262078591f)
-#define cos_pi_6    Qfmt31( 0.86602540378444f)
-#define cos_5pi_6   Qfmt31(-0.86602540378444f)
-#define cos_5pi_18  Qfmt31( 0.64278760968654f)
-#define cos_7pi_18  Qfmt31( 0.34202014332567f)
-#define cos_11pi_18 Qfmt31(-0.34202014332567f)
-#define cos_13pi_18 Qfmt31(-0.64278760968654f)
-#define cos_17pi_18 Qfmt31(-0.98480775301221f)
 
 /*----------------------------------------------------------------------------
 ; LOCAL FUNCTION DEFINITIONS
@@ -214,6 +214,7 @@ OSCL_EXPORT_REF int32 CPvMP3_Decoder::StartL(tPVMP3DecoderExternal * pExt,
         iOutputBuf = NULL;
     }
     pExt->pOutputBuffer = iOutputBuf;
+    pExt->pOutputBufferFloat = NULL;
 
     pExt->crcEnabled               = crcEnabler;
     pExt->equalizerType            = equalizType;  /* Dynamically enable equalizing type */
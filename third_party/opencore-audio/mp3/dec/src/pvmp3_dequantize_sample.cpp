@@ -347,7 +347,12 @@ void pvmp3_dequantize_sample(int32 is[SUBBANDS_NUMBER*FILTERBANK_BANDS],
                     global_gain = - global_gain;
                     if (global_gain < 32)
                     {
-                        for (ss = mp3_sfBandIndex[sfreq].l[cb]; ss < mp3_sfBandIndex[sfreq].l[cb+1]; ss += 2)
+                        ss = mp3_sfBandIndex[sfreq].l[cb];
+#if defined(PVMP3_SIMD_DEQUANTIZE)
+                        ss += pvmp3_dequantize_lines_simd(&is[ss], mp3_sfBandIndex[sfreq].l[cb+1] - ss,
+                                                          two_raise_one_fourth, -global_gain);
+#endif
+                        for (; ss < mp3_sfBandIndex[sfreq].l[cb+1]; ss += 2)
                         {
                             int32 tmp =  is[ss];
                             if (tmp)
@@ -372,7 +377,12 @@ void pvmp3_dequantize_sample(int32 is[SUBBANDS_NUMBER*FILTERBANK_BANDS],
                 }
                 else
                 {
-                    for (ss = mp3_sfBandIndex[sfreq].l[cb]; ss < mp3_sfBandIndex[sfreq].l[cb+1]; ss += 2)
+                    ss = mp3_sfBandIndex[sfreq].l[cb];
+#if defined(PVMP3_SIMD_DEQUANTIZE)
+                    ss += pvmp3_dequantize_lines_simd(&is[ss], mp3_sfBandIndex[sfreq].l[cb+1] - ss,
+                                                      two_raise_one_fourth, global_gain);
+#endif
+                    for (; ss < mp3_sfBandIndex[sfreq].l[cb+1]; ss += 2)
                     {
                         int32 tmp =  is[ss];
                         if (tmp)
@@ -397,7 +407,12 @@ void pvmp3_dequantize_sample(int32 is[SUBBANDS_NUMBER*FILTERBANK_BANDS],
                     global_gain = - global_gain;
                     if (global_gain < 32)
                     {
-                        for (ss = mp3_sfBandIndex[sfreq].l[cb]; ss < used_freq_lines; ss += 2)
+                        ss = mp3_sfBandIndex[sfreq].l[cb];
+#if defined(PVMP3_SIMD_DEQUANTIZE)
+                        ss += pvmp3_dequantize_lines_simd(&is[ss], used_freq_lines - ss,
+                                                          two_raise_one_fourth, -global_gain);
+#endif
+                        for (; ss < used_freq_lines; ss += 2)
                         {
                             int32 tmp =  is[ss];
                             if (tmp)
@@ -423,7 +438,12 @@ void pvmp3_dequantize_sample(int32 is[SUBBANDS_NUMBER*FILTERBANK_BANDS],
                 }
                 else
                 {
-                    for (ss = mp3_sfBandIndex[sfreq].l[cb]; ss < used_freq_lines; ss++)
+                    ss = mp3_sfBandIndex[sfreq].l[cb];
+#if defined(PVMP3_SIMD_DEQUANTIZE)
+                    ss += pvmp3_dequantize_lines_simd(&is[ss], used_freq_lines - ss,
+                                                      two_raise_one_fourth, global_gain);
+#endif
+                    for (; ss < used_freq_lines; ss++)
                     {
                         int32 tmp =  is[ss];
 
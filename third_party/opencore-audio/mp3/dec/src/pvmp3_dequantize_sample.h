@@ -94,6 +94,23 @@ extern "C"
                                  int32  num_lines,
                                  mp3Header *info);
 
+    /*
+     * Vector version of the long block loops in pvmp3_dequantize_sample().
+     * Scales is[0..n) the same way, then shifts left by shift, or right by
+     * -shift.  Returns how many lines it did, a multiple of its vector
+     * length, or 0 if there's no vector version on this CPU; the caller
+     * does the rest.  The results are bit-identical to C_EQUIVALENT.
+     */
+#if defined(C_EQUIVALENT) && !defined(PVMP3_NO_SIMD) && defined(__GNUC__) && \
+    defined(__x86_64__)
+#define PVMP3_SIMD_DEQUANTIZE 1
+
+    int32 pvmp3_dequantize_lines_simd(int32 *is,
+                                      int32 n,
+                                      int32 two_raise_one_fourth,
+                                      int32 shift);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
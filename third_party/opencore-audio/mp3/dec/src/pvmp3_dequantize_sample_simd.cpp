@@ -0,0 +1,141 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2008 PacketVideo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+/*
+
+   Filename: pvmp3_dequantize_sample_simd.cpp
+
+------------------------------------------------------------------------------
+
+ Vector version of the long block loops in pvmp3_dequantize_sample(),
+ eight lines at a time with AVX2.
+
+ Most of the work per line is the power_one_third[] lookup, which AVX2
+ can do with a gather.  Lines with |is| > 512 take the interpolated path
+ in power_1_third(); they are rare, and a group of eight that has one is
+ done with the C code instead.  A zero line comes out zero either way,
+ so unlike the C loops there is no test for it.  Each product is
+ truncated the way fxp_mul32_Q30 truncates it, so the output is
+ bit-identical.
+
+ There's no NEON version: NEON has no gather, and the lookup would be
+ done one lane at a time anyway.
+
+------------------------------------------------------------------------------
+*/
+
+#include "pvmp3_dequantize_sample.h"
+
+#if defined(PVMP3_SIMD_DEQUANTIZE)
+
+#include "pv_mp3dec_fxd_op.h"
+#include "pvmp3_tables.h"
+
+#include <immintrin.h>
+
+/*----------------------------------------------------------------------------
+; DEFINES
+----------------------------------------------------------------------------*/
+
+#define DEQUANTIZE_LANES  8
+
+/*----------------------------------------------------------------------------
+; FUNCTION CODE
+----------------------------------------------------------------------------*/
+
+/* Same as the body of the C loops, for one line. */
+static inline int32 dequantize_line(int32 tmp,
+                                    int32 two_raise_one_fourth,
+                                    int32 shift)
+{
+    if (tmp)
+    {
+        tmp = fxp_mul32_Q30((tmp << 16), power_1_third(pv_abs(tmp)));
+        tmp = fxp_mul32_Q30(tmp, two_raise_one_fourth);
+        tmp = (shift >= 0) ? (tmp << shift) : (tmp >> -shift);
+    }
+    return tmp;
+}
+
+/* Bits 30..61 of the signed 64-bit product of each lane. */
+__attribute__((target("avx2")))
+static inline __m256i MulQ30_AVX2(__m256i a, __m256i b)
+{
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                    _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, 30),
+                              _mm256_slli_epi64(odd, 2),
+                              0xAA);
+}
+
+__attribute__((target("avx2")))
+static int32 Dequantize_AVX2(int32 *is,
+                             int32 n,
+                             int32 two_raise_one_fourth,
+                             int32 shift)
+{
+    const __m256i limit = _mm256_set1_epi32(512);
+    const __m256i scale = _mm256_set1_epi32(two_raise_one_fourth);
+    const __m128i count = _mm_cvtsi32_si128(shift >= 0 ? shift : -shift);
+    int32 ss;
+
+    for (ss = 0; ss + DEQUANTIZE_LANES <= n; ss += DEQUANTIZE_LANES)
+    {
+        __m256i x   = _mm256_loadu_si256((const __m256i *)&is[ss]);
+        __m256i ax  = _mm256_abs_epi32(x);
+
+        if (!_mm256_testz_si256(_mm256_cmpgt_epi32(ax, limit),
+                                _mm256_set1_epi32(-1)))
+        {
+            for (int32 l = ss; l < ss + DEQUANTIZE_LANES; l++)
+                is[l] = dequantize_line(is[l], two_raise_one_fourth, shift);
+            continue;
+        }
+
+        __m256i p   = _mm256_srai_epi32(_mm256_i32gather_epi32(power_one_third, ax, 4), 1);
+        __m256i tmp = MulQ30_AVX2(_mm256_slli_epi32(x, 16), p);
+
+        tmp = MulQ30_AVX2(tmp, scale);
+        tmp = (shift >= 0) ? _mm256_sll_epi32(tmp, count) : _mm256_sra_epi32(tmp, count);
+        _mm256_storeu_si256((__m256i *)&is[ss], tmp);
+    }
+
+    return ss;
+}
+
+static bool HaveAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+int32 pvmp3_dequantize_lines_simd(int32 *is,
+                                  int32 n,
+                                  int32 two_raise_one_fourth,
+                                  int32 shift)
+{
+    static const bool avx2 = HaveAvx2();
+
+    /* A left shift of 32 or more isn't defined for the C code to match. */
+    if (!avx2 || shift >= 32 || shift <= -32)
+        return 0;
+
+    return Dequantize_AVX2(is, n, two_raise_one_fourth, shift);
+}
+
+#endif /* PVMP3_SIMD_DEQUANTIZE */
@@ -210,6 +210,7 @@ ERROR_CODE pvmp3_framedecoder(tPVMP3DecoderExternal *pExt,
         uint32 main_data_end;
         int32 bytes_to_discard;
         int16 *ptrOutBuffer = pExt->pOutputBuffer;
+        float *ptrOutBufferFloat = pExt->pOutputBufferFloat;
 
         /*
          * Side Information must be extracted from the bitstream and store for use
@@ -462,12 +463,16 @@ ERROR_CODE pvmp3_framedecoder(tPVMP3DecoderExternal *pExt,
                 pvmp3_poly_phase_synthesis(pChVars[ch],
                                            pVars->num_channels,
                                            pExt->equalizerType,
-                                           &ptrOutBuffer[ch]);
+                                           ptrOutBufferFloat ? NULL : &ptrOutBuffer[ch],
+                                           ptrOutBufferFloat ? &ptrOutBufferFloat[ch] : NULL);
 
 
             }/* end ch loop */
 
-            ptrOutBuffer += pVars->num_channels * SUBBANDS_NUMBER * FILTERBANK_BANDS;
+            if (ptrOutBufferFloat)
+                ptrOutBufferFloat += pVars->num_channels * SUBBANDS_NUMBER * FILTERBANK_BANDS;
+            else
+                ptrOutBuffer += pVars->num_channels * SUBBANDS_NUMBER * FILTERBANK_BANDS;
         }  /*   for (gr=0;gr<Max_gr;gr++)  */
 
         /* skip ancillary data */
@@ -229,6 +229,15 @@ void pvmp3_imdct_synth(int32  in[SUBBANDS_NUMBER*FILTERBANK_BANDS],
         bands2process = SUBBANDS_NUMBER;  /* default */
     }
 
+#if defined(PVMP3_SIMD_IMDCT)
+    /*
+     * Runs of subbands that use the same window are transformed several
+     * at a time.  Subbands below simd_done already have been.
+     */
+    int32 lanes     = pvmp3_mdct_18_simd_lanes();
+    int32 simd_done = 0;
+#endif
+
 
     /*
      *  in case of mx_poly_band> 0, do
@@ -243,6 +252,31 @@ void pvmp3_imdct_synth(int32  in[SUBBANDS_NUMBER*FILTERBANK_BANDS],
         int32 * out     = in      + (band * FILTERBANK_BANDS);
         int32 * history = overlap + (band * FILTERBANK_BANDS);
 
+#if defined(PVMP3_SIMD_IMDCT)
+        if (band < simd_done)
+        {
+            /* done with the rest of its group */
+        }
+        else if (lanes &&
+                 band + lanes <= bands2process &&
+                 (current_blk_type == blk_type || band + lanes <= mx_band))
+        {
+            if (current_blk_type == SHORT)
+            {
+                pvmp3_mdct_6_simd(out, history, short_win);
+            }
+            else
+            {
+                const int32 *window = (current_blk_type == START) ? start_win :
+                                      (current_blk_type == STOP)  ? stop_win  :
+                                      normal_win;
+
+                pvmp3_mdct_18_simd(out, history, window);
+            }
+            simd_done = band + lanes;
+        }
+        else
+#endif
         switch (current_blk_type)
         {
             case LONG:
@@ -63,6 +63,22 @@
 #define Qfmt1(a)   (Int32)(a*((Int32)0x7FFFFFFF))
 #define Qfmt2(a)   (Int32)(a*((Int32)1<<27))
 
+#define Qfmt31(a)   (int32)(a*(0x7FFFFFFF))
+
+#define cos_pi_9    Qfmt31( 0.93969262078591f)
+#define cos_2pi_9   Qfmt31( 0.76604444311898f)
+#define cos_4pi_9   Qfmt31( 0.17364817766693f)
+#define cos_5pi_9   Qfmt31(-0.17364817766693f)
+#define cos_7pi_9   Qfmt31(-0.76604444311898f)
+#define cos_8pi_9   Qfmt31(-0.93969262078591f)
+#define cos_pi_6    Qfmt31( 0.86602540378444f)
+#define cos_5pi_6   Qfmt31(-0.86602540378444f)
+#define cos_5pi_18  Qfmt31( 0.64278760968654f)
+#define cos_7pi_18  Qfmt31( 0.34202014332567f)
+#define cos_11pi_18 Qfmt31(-0.34202014332567f)
+#define cos_13pi_18 Qfmt31(-0.64278760968654f)
+#define cos_17pi_18 Qfmt31(-0.98480775301221f)
+
 /*----------------------------------------------------------------------------
 ; EXTERNAL VARIABLES REFERENCES
 ; Declare variables used in this module but defined elsewhere
@@ -89,6 +105,9 @@ extern "C"
 {
 #endif
 
+    extern const int32 cosTerms_dct18[9];
+    extern const int32 cosTerms_1_ov_cos_phi[18];
+
     void pvmp3_mdct_18(int32 vec[], int32 *history, const int32 *window);
 
     void pvmp3_dct_9(int32 vec[]);
@@ -97,6 +116,25 @@ extern "C"
 
     void pvmp3_dct_6(int32 vec[]);
 
+    /*
+     * Vector version of pvmp3_mdct_18() for several subbands that share
+     * a window.  pvmp3_mdct_18_simd_lanes() says how many subbands one
+     * call does, or 0 if there's no vector version on this CPU.  The
+     * subbands are consecutive, FILTERBANK_BANDS apart in vec[] and
+     * history[], and the results are bit-identical to C_EQUIVALENT.
+     */
+#if defined(C_EQUIVALENT) && !defined(PVMP3_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define PVMP3_SIMD_IMDCT 1
+
+    int32 pvmp3_mdct_18_simd_lanes(void);
+
+    void pvmp3_mdct_18_simd(int32 vec[], int32 *history, const int32 *window);
+
+    /* The SHORT case of pvmp3_imdct_synth(); window is its short_win. */
+    void pvmp3_mdct_6_simd(int32 vec[], int32 *history, const int32 *window);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
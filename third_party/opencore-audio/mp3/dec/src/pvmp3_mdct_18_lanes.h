@@ -0,0 +1,424 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2008 PacketVideo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+/*
+
+   Filename: pvmp3_mdct_18_lanes.h
+
+------------------------------------------------------------------------------
+
+ pvmp3_mdct_18(), pvmp3_dct_9() and the short block transform, written
+ once for any vector width.  Lane l of every vector works on subband l
+ of the group, so the code is the C code statement for statement, with
+ each int32 replaced by a vector.
+
+ Ops supplies the vector type V, Lanes, and:
+
+    Load/Store     unaligned load and store of Lanes int32s
+    Transpose      transposes a Lanes x Lanes block held in Lanes vectors
+    Add/Sub/Neg    wrapping 32-bit arithmetic
+    Shl1/Shr1      << 1, and arithmetic >> 1
+    Mul<Q>(a, b)   (int32)(((int64)a * b) >> Q) for each lane of a, with
+                   b a constant
+
+ This has no include guard: pvmp3_mdct_18_simd.cpp includes it once per
+ instruction set, each time inside its own namespace.  The constants
+ and tables it shares with pvmp3_dct_9.cpp and pvmp3_mdct_18.cpp come
+ from pvmp3_mdct_18.h, and those it shares with pvmp3_dct_6.cpp and
+ pvmp3_mdct_6.cpp from pvmp3_mdct_6.h.
+
+------------------------------------------------------------------------------
+*/
+
+template <class Ops>
+static inline typename Ops::V Mac32(typename Ops::V acc,
+                                    typename Ops::V a,
+                                    int32 b)
+{
+    return Ops::Add(acc, Ops::template Mul<32>(a, b));
+}
+
+template <class Ops>
+static inline typename Ops::V Mul32(typename Ops::V a, int32 b)
+{
+    return Ops::template Mul<32>(a, b);
+}
+
+template <class Ops>
+static inline void Dct9(typename Ops::V vec[9])
+{
+    typedef typename Ops::V V;
+
+    V tmp0 = Ops::Add(vec[8], vec[0]);
+    V tmp8 = Ops::Sub(vec[8], vec[0]);
+    V tmp1 = Ops::Add(vec[7], vec[1]);
+    V tmp7 = Ops::Sub(vec[7], vec[1]);
+    V tmp2 = Ops::Add(vec[6], vec[2]);
+    V tmp6 = Ops::Sub(vec[6], vec[2]);
+    V tmp3 = Ops::Add(vec[5], vec[3]);
+    V tmp5 = Ops::Sub(vec[5], vec[3]);
+
+    V sum  = Ops::Add(Ops::Add(tmp0, tmp2), tmp3);
+    V mid  = Ops::Add(tmp1, vec[4]);
+
+    vec[0] = Ops::Add(sum, mid);
+    vec[6] = Ops::Sub(Ops::Shr1(sum), mid);
+    vec[2] = Ops::Sub(Ops::Shr1(tmp1), vec[4]);
+    vec[4] = Ops::Neg(vec[2]);
+    vec[8] = Ops::Neg(vec[2]);
+
+    tmp0 = Ops::Shl1(tmp0);
+    tmp2 = Ops::Shl1(tmp2);
+    tmp3 = Ops::Shl1(tmp3);
+
+    vec[4] = Mac32<Ops>(vec[4], tmp0, cos_2pi_9);
+    vec[8] = Mac32<Ops>(vec[8], tmp0, cos_4pi_9);
+    vec[2] = Mac32<Ops>(vec[2], tmp0, cos_pi_9);
+    vec[2] = Mac32<Ops>(vec[2], tmp2, cos_5pi_9);
+    vec[4] = Mac32<Ops>(vec[4], tmp2, cos_8pi_9);
+    vec[8] = Mac32<Ops>(vec[8], tmp2, cos_2pi_9);
+    vec[8] = Mac32<Ops>(vec[8], tmp3, cos_8pi_9);
+    vec[4] = Mac32<Ops>(vec[4], tmp3, cos_4pi_9);
+    vec[2] = Mac32<Ops>(vec[2], tmp3, cos_7pi_9);
+
+    V t3 = Ops::Shl1(Ops::Sub(Ops::Add(tmp5, tmp6), tmp8));
+
+    tmp5 = Ops::Shl1(tmp5);
+    tmp6 = Ops::Shl1(tmp6);
+    tmp7 = Ops::Shl1(tmp7);
+    tmp8 = Ops::Shl1(tmp8);
+
+    vec[1] = Mul32<Ops>(tmp5, cos_11pi_18);
+    vec[1] = Mac32<Ops>(vec[1], tmp6, cos_13pi_18);
+    vec[1] = Mac32<Ops>(vec[1], tmp7, cos_5pi_6);
+    vec[1] = Mac32<Ops>(vec[1], tmp8, cos_17pi_18);
+    vec[3] = Mul32<Ops>(t3, cos_pi_6);
+    vec[5] = Mul32<Ops>(tmp5, cos_17pi_18);
+    vec[5] = Mac32<Ops>(vec[5], tmp6, cos_7pi_18);
+    vec[5] = Mac32<Ops>(vec[5], tmp7, cos_pi_6);
+    vec[5] = Mac32<Ops>(vec[5], tmp8, cos_13pi_18);
+    vec[7] = Mul32<Ops>(tmp5, cos_5pi_18);
+    vec[7] = Mac32<Ops>(vec[7], tmp6, cos_17pi_18);
+    vec[7] = Mac32<Ops>(vec[7], tmp7, cos_pi_6);
+    vec[7] = Mac32<Ops>(vec[7], tmp8, cos_11pi_18);
+}
+
+/*
+ * Lane l of v[i] is src[l * FILTERBANK_BANDS + i].  Done as square blocks
+ * of columns; the last block overlaps the one before it if Lanes doesn't
+ * divide FILTERBANK_BANDS.
+ */
+template <class Ops>
+static inline void LoadColumns(typename Ops::V v[FILTERBANK_BANDS],
+                               const int32 *src)
+{
+    typename Ops::V r[Ops::Lanes];
+    int32 col = 0;
+
+    for (;;)
+    {
+        if (col > FILTERBANK_BANDS - Ops::Lanes)
+            col = FILTERBANK_BANDS - Ops::Lanes;
+        for (int32 l = 0; l < Ops::Lanes; l++)
+            r[l] = Ops::Load(&src[l * FILTERBANK_BANDS + col]);
+        Ops::Transpose(r);
+        for (int32 l = 0; l < Ops::Lanes; l++)
+            v[col + l] = r[l];
+        if (col == FILTERBANK_BANDS - Ops::Lanes)
+            break;
+        col += Ops::Lanes;
+    }
+}
+
+template <class Ops>
+static inline void StoreColumns(int32 *dst,
+                                const typename Ops::V v[FILTERBANK_BANDS])
+{
+    typename Ops::V r[Ops::Lanes];
+    int32 col = 0;
+
+    for (;;)
+    {
+        if (col > FILTERBANK_BANDS - Ops::Lanes)
+            col = FILTERBANK_BANDS - Ops::Lanes;
+        for (int32 l = 0; l < Ops::Lanes; l++)
+            r[l] = v[col + l];
+        Ops::Transpose(r);
+        for (int32 l = 0; l < Ops::Lanes; l++)
+            Ops::Store(&dst[l * FILTERBANK_BANDS + col], r[l]);
+        if (col == FILTERBANK_BANDS - Ops::Lanes)
+            break;
+        col += Ops::Lanes;
+    }
+}
+
+template <class Ops>
+static inline void Mdct18(int32 vec[], int32 *history, const int32 *window)
+{
+    typedef typename Ops::V V;
+
+    V v[FILTERBANK_BANDS];
+    V h[FILTERBANK_BANDS];
+    V tmp, tmp1, tmp2, tmp3, tmp4;
+    int32 i;
+
+    LoadColumns<Ops>(v, vec);
+    LoadColumns<Ops>(h, history);
+
+    for (i = 0; i < 9; i++)
+    {
+        tmp  = v[i];
+        tmp1 = v[17 - i];
+        tmp  = Ops::template Mul<32>(Ops::Shl1(tmp), cosTerms_1_ov_cos_phi[i]);
+        tmp1 = Ops::template Mul<27>(tmp1, cosTerms_1_ov_cos_phi[17 - i]);
+        v[i] = Ops::Add(tmp, tmp1);
+        v[17 - i] = Ops::template Mul<28>(Ops::Sub(tmp, tmp1), cosTerms_dct18[i]);
+    }
+
+    Dct9<Ops>(&v[0]);         // Even terms
+    Dct9<Ops>(&v[9]);         // Odd  terms
+
+    tmp3  = v[16];
+    v[16] = v[ 8];
+    tmp4  = v[14];
+    v[14] = v[ 7];
+    tmp   = v[12];
+    v[12] = v[ 6];
+    tmp2  = v[10];
+    v[10] = v[ 5];
+    v[ 8] = v[ 4];
+    v[ 6] = v[ 3];
+    v[ 4] = v[ 2];
+    v[ 2] = v[ 1];
+    v[ 1] = Ops::Sub(v[ 9], tmp2);
+    v[ 3] = Ops::Sub(v[11], tmp2);
+    v[ 5] = Ops::Sub(v[11], tmp);
+    v[ 7] = Ops::Sub(v[13], tmp);
+    v[ 9] = Ops::Sub(v[13], tmp4);
+    v[11] = Ops::Sub(v[15], tmp4);
+    v[13] = Ops::Sub(v[15], tmp3);
+    v[15] = Ops::Sub(v[17], tmp3);
+
+    /* overlap and add */
+
+    tmp2 = v[0];
+    tmp3 = v[9];
+
+    for (i = 0; i < 6; i++)
+    {
+        tmp  = h[i];
+        tmp4 = v[i + 10];
+        v[i + 10] = Ops::Add(tmp3, tmp4);
+        tmp1 = v[i + 1];
+        v[i] = Mac32<Ops>(tmp, v[i + 10], window[i]);
+        tmp3 = tmp4;
+        h[i] = Ops::Neg(Ops::Add(tmp2, tmp1));
+        tmp2 = tmp1;
+    }
+
+    tmp  = h[6];
+    tmp4 = v[16];
+    v[16] = Ops::Add(tmp3, tmp4);
+    tmp1 = v[7];
+    v[ 6] = Mac32<Ops>(tmp, Ops::Shl1(v[16]), window[6]);
+    tmp  = h[7];
+    h[6] = Ops::Neg(Ops::Add(tmp2, tmp1));
+    h[7] = Ops::Neg(Ops::Add(tmp1, v[8]));
+
+    tmp1  = h[8];
+    tmp4  = Ops::Add(v[17], tmp4);
+    v[ 7] = Mac32<Ops>(tmp, Ops::Shl1(tmp4), window[7]);
+    h[8]  = Ops::Neg(Ops::Add(v[8], v[9]));
+    v[ 8] = Mac32<Ops>(tmp1, Ops::Shl1(v[17]), window[8]);
+
+    tmp  = h[9];
+    tmp1 = h[17];
+    tmp2 = h[16];
+    v[ 9] = Mac32<Ops>(tmp, Ops::Shl1(v[17]), window[9]);
+
+    v[17] = Mac32<Ops>(tmp1, Ops::Shl1(v[10]), window[17]);
+    v[10] = Ops::Neg(v[16]);
+    v[16] = Mac32<Ops>(tmp2, Ops::Shl1(v[11]), window[16]);
+    tmp1 = h[15];
+    tmp2 = h[14];
+    v[11] = Ops::Neg(v[15]);
+    v[15] = Mac32<Ops>(tmp1, Ops::Shl1(v[12]), window[15]);
+    v[12] = Ops::Neg(v[14]);
+    v[14] = Mac32<Ops>(tmp2, Ops::Shl1(v[13]), window[14]);
+
+    tmp  = h[13];
+    tmp1 = h[12];
+    tmp2 = h[11];
+    tmp3 = h[10];
+    v[13] = Mac32<Ops>(tmp,  Ops::Shl1(v[12]), window[13]);
+    v[12] = Mac32<Ops>(tmp1, Ops::Shl1(v[11]), window[12]);
+    v[11] = Mac32<Ops>(tmp2, Ops::Shl1(v[10]), window[11]);
+    v[10] = Mac32<Ops>(tmp3, Ops::Shl1(tmp4),  window[10]);
+
+    /* next iteration overlap */
+
+    tmp1 = Ops::Shl1(h[8]);
+    tmp3 = Ops::Shl1(h[7]);
+    tmp2 = Ops::Shl1(h[1]);
+    tmp  = Ops::Shl1(h[0]);
+
+    h[ 0] = Mul32<Ops>(tmp1, window[18]);
+    h[17] = Mul32<Ops>(tmp1, window[35]);
+    h[ 1] = Mul32<Ops>(tmp3, window[19]);
+    h[16] = Mul32<Ops>(tmp3, window[34]);
+
+    h[ 7] = Mul32<Ops>(tmp2, window[25]);
+    h[10] = Mul32<Ops>(tmp2, window[28]);
+    h[ 8] = Mul32<Ops>(tmp,  window[26]);
+    h[ 9] = Mul32<Ops>(tmp,  window[27]);
+
+    tmp1 = Ops::Shl1(h[6]);
+    tmp3 = Ops::Shl1(h[5]);
+    tmp4 = Ops::Shl1(h[4]);
+    tmp2 = Ops::Shl1(h[3]);
+    tmp  = Ops::Shl1(h[2]);
+
+    h[ 2] = Mul32<Ops>(tmp1, window[20]);
+    h[15] = Mul32<Ops>(tmp1, window[33]);
+    h[ 3] = Mul32<Ops>(tmp3, window[21]);
+    h[14] = Mul32<Ops>(tmp3, window[32]);
+    h[ 4] = Mul32<Ops>(tmp4, window[22]);
+    h[13] = Mul32<Ops>(tmp4, window[31]);
+    h[ 5] = Mul32<Ops>(tmp2, window[23]);
+    h[12] = Mul32<Ops>(tmp2, window[30]);
+    h[ 6] = Mul32<Ops>(tmp,  window[24]);
+    h[11] = Mul32<Ops>(tmp,  window[29]);
+
+    StoreColumns<Ops>(vec, v);
+    StoreColumns<Ops>(history, h);
+}
+
+/*
+ The short block transform: pvmp3_dct_6(), pvmp3_mdct_6(), and the
+ SHORT case of pvmp3_imdct_synth() that runs it over the three windows
+ and overlaps them.
+*/
+
+template <class Ops>
+static inline void Dct6(typename Ops::V vec[6])
+{
+    typedef typename Ops::V V;
+
+    V tmp0 = Ops::Add(vec[5], vec[0]);
+    V tmp5 = Ops::Sub(vec[5], vec[0]);
+    V tmp1 = Ops::Add(vec[4], vec[1]);
+    V tmp4 = Ops::Sub(vec[4], vec[1]);
+    V tmp2 = Ops::Add(vec[3], vec[2]);
+    V tmp3 = Ops::Sub(vec[3], vec[2]);
+
+    vec[0] = Ops::Add(tmp0, tmp2);
+    vec[2] = Ops::template Mul<30>(Ops::Sub(tmp0, tmp2), cos_pi_6_q30);
+    vec[4] = Ops::Sub(Ops::Shr1(vec[0]), tmp1);
+    vec[0] = Ops::Add(vec[0], tmp1);
+
+    tmp0   = Ops::template Mul<30>(tmp3, cos_7_pi_12);
+    tmp0   = Ops::Add(tmp0, Ops::template Mul<30>(tmp4, -cos_3_pi_12));
+    vec[1] = Ops::Add(tmp0, Ops::template Mul<30>(tmp5, cos_11_pi_12));
+
+    vec[3] = Ops::template Mul<30>(Ops::Sub(Ops::Add(tmp3, tmp4), tmp5), cos_3_pi_12);
+    tmp0   = Ops::template Mul<30>(tmp3, cos_11_pi_12);
+    tmp0   = Ops::Add(tmp0, Ops::template Mul<30>(tmp4, cos_3_pi_12));
+    vec[5] = Ops::Add(tmp0, Ops::template Mul<30>(tmp5, cos_7_pi_12));
+}
+
+template <class Ops>
+static inline void Mdct6(typename Ops::V vec[6], typename Ops::V history[6])
+{
+    typedef typename Ops::V V;
+
+    V tmp;
+    int32 i;
+
+    for (i = 0; i < 6; i++)
+        vec[i] = Ops::template Mul<29>(vec[i], cosTerms_1_ov_cos_phi_N6[i]);
+
+    Dct6<Ops>(vec);
+
+    tmp = Ops::Neg(Ops::Add(vec[0], vec[1]));
+    history[3] = tmp;
+    history[2] = tmp;
+    tmp = Ops::Neg(Ops::Add(vec[1], vec[2]));
+    vec[0] = Ops::Add(vec[3], vec[4]);
+    vec[1] = Ops::Add(vec[4], vec[5]);
+    history[4] = tmp;
+    history[1] = tmp;
+    tmp = Ops::Neg(Ops::Add(vec[2], vec[3]));
+    vec[4] = Ops::Neg(vec[1]);
+    history[5] = tmp;
+    history[0] = tmp;
+
+    vec[2] = vec[5];
+    vec[3] = Ops::Neg(vec[5]);
+    vec[5] = Ops::Neg(vec[0]);
+}
+
+template <class Ops>
+static inline void MdctShort(int32 vec[], int32 *history, const int32 *window)
+{
+    typedef typename Ops::V V;
+
+    V v[FILTERBANK_BANDS];
+    V h[FILTERBANK_BANDS];
+    V s[FILTERBANK_BANDS];
+    V o[FILTERBANK_BANDS];
+    int32 i;
+
+    LoadColumns<Ops>(v, vec);
+    LoadColumns<Ops>(h, history);
+
+    for (i = 0; i < 6; i++)
+    {
+        s[i     ] = v[(i*3)];
+        s[6  + i] = v[(i*3) + 1];
+        s[12 + i] = v[(i*3) + 2];
+    }
+
+    Mdct6<Ops>(&s[ 0], &o[ 0]);
+    Mdct6<Ops>(&s[ 6], &o[ 6]);
+    Mdct6<Ops>(&s[12], &o[12]);
+
+    for (i = 0; i < 6; i++)
+    {
+        v[i] = h[i];
+        /* next iteration overlap */
+        h[i] = Mac32<Ops>(Mul32<Ops>(Ops::Shl1(o[6 + i]), window[6 + i]),
+                          Ops::Shl1(s[12 + i]), window[i]);
+    }
+
+    for (i = 0; i < 6; i++)
+    {
+        v[i + 6] = Ops::Add(Mul32<Ops>(Ops::Shl1(s[i]), window[i]), h[i + 6]);
+        /* next iteration overlap */
+        h[i + 6] = Mul32<Ops>(Ops::Shl1(o[12 + i]), window[6 + i]);
+    }
+
+    for (i = 0; i < 6; i++)
+    {
+        v[i + 12] = Mac32<Ops>(Mul32<Ops>(Ops::Shl1(o[i]), window[6 + i]),
+                               Ops::Shl1(s[6 + i]), window[i]);
+        v[i + 12] = Ops::Add(v[i + 12], h[i + 12]);
+        h[i + 12] = Ops::Sub(h[i + 12], h[i + 12]);     /* 0 */
+    }
+
+    StoreColumns<Ops>(vec, v);
+    StoreColumns<Ops>(history, h);
+}
@@ -0,0 +1,356 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2008 PacketVideo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+/*
+
+   Filename: pvmp3_mdct_18_simd.cpp
+
+------------------------------------------------------------------------------
+
+ Vector versions of pvmp3_mdct_18() and of the short block transform
+ in pvmp3_imdct_synth(), one subband per lane.  The body is
+ in pvmp3_mdct_18_lanes.h; this file supplies the operations for each
+ instruction set.  Every product is truncated the same way the
+ C_EQUIVALENT fxp_mul32_Q* functions truncate it, and the 32-bit
+ arithmetic wraps the same way, so the output is bit-identical.
+
+ x86-64 uses AVX2, eight subbands at a time, if the CPU has it, and
+ otherwise SSE4.1, four at a time.  Plain SSE2 has no signed 32x32->64
+ multiply; with the sign fix-up that pvmp3_polyphase_filter_window_simd.cpp
+ uses it came out about a quarter slower than the C code, so on a CPU
+ without SSE4.1 the C code runs.  AArch64 always has NEON and does four
+ subbands at a time.
+
+------------------------------------------------------------------------------
+*/
+
+#include "pvmp3_mdct_18.h"
+
+#if defined(PVMP3_SIMD_IMDCT)
+
+#include "pvmp3_dec_defs.h"
+#include "pvmp3_mdct_6.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if defined(__x86_64__)
+
+/*
+ * As below for AVX2, compiled for SSE4.1, four subbands at a time.
+ */
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#endif
+
+namespace
+{
+namespace sse41
+{
+
+struct Ops
+{
+    typedef __m128i V;
+    static const int32 Lanes = 4;
+
+    static inline V Load(const int32 *p)
+    {
+        return _mm_loadu_si128((const __m128i *)p);
+    }
+    static inline void Store(int32 *p, V v)
+    {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+    static inline void Transpose(V r[4])
+    {
+        __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+        __m128i t1 = _mm_unpackhi_epi32(r[0], r[1]);
+        __m128i t2 = _mm_unpacklo_epi32(r[2], r[3]);
+        __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+        r[0] = _mm_unpacklo_epi64(t0, t2);
+        r[1] = _mm_unpackhi_epi64(t0, t2);
+        r[2] = _mm_unpacklo_epi64(t1, t3);
+        r[3] = _mm_unpackhi_epi64(t1, t3);
+    }
+    static inline V Add(V a, V b)
+    {
+        return _mm_add_epi32(a, b);
+    }
+    static inline V Sub(V a, V b)
+    {
+        return _mm_sub_epi32(a, b);
+    }
+    static inline V Neg(V a)
+    {
+        return _mm_sub_epi32(_mm_setzero_si128(), a);
+    }
+    static inline V Shl1(V a)
+    {
+        return _mm_slli_epi32(a, 1);
+    }
+    static inline V Shr1(V a)
+    {
+        return _mm_srai_epi32(a, 1);
+    }
+    template <int Q>
+    static inline V Mul(V a, int32 b)
+    {
+        __m128i vb   = _mm_set1_epi32(b);
+        __m128i even = _mm_mul_epi32(a, vb);
+        __m128i odd  = _mm_mul_epi32(_mm_srli_epi64(a, 32), vb);
+        return _mm_blend_epi16(_mm_srli_epi64(even, Q),
+                               _mm_slli_epi64(odd, 32 - Q),
+                               0xCC);
+    }
+};
+
+#include "pvmp3_mdct_18_lanes.h"
+
+} // namespace sse41
+} // namespace
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+/*
+ * Everything from here to the pop, including the template body, is
+ * compiled for AVX2.  It lives in its own namespace so none of it can be
+ * mistaken for code that's safe to run without AVX2.
+ */
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace
+{
+namespace avx2
+{
+
+struct Ops
+{
+    typedef __m256i V;
+    static const int32 Lanes = 8;
+
+    static inline V Load(const int32 *p)
+    {
+        return _mm256_loadu_si256((const __m256i *)p);
+    }
+    static inline void Store(int32 *p, V v)
+    {
+        _mm256_storeu_si256((__m256i *)p, v);
+    }
+    static inline void Transpose(V r[8])
+    {
+        __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+        __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+        __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+        __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+        __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+        __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+        __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+        __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+        __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+        __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+        __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+        __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+        __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+        __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+        __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+        __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+        r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+        r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+        r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+        r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+        r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+        r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+        r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+        r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+    }
+    static inline V Add(V a, V b)
+    {
+        return _mm256_add_epi32(a, b);
+    }
+    static inline V Sub(V a, V b)
+    {
+        return _mm256_sub_epi32(a, b);
+    }
+    static inline V Neg(V a)
+    {
+        return _mm256_sub_epi32(_mm256_setzero_si256(), a);
+    }
+    static inline V Shl1(V a)
+    {
+        return _mm256_slli_epi32(a, 1);
+    }
+    static inline V Shr1(V a)
+    {
+        return _mm256_srai_epi32(a, 1);
+    }
+
+    /*
+     * Bits Q..Q+31 of each 64-bit product: the even lanes' products
+     * shifted down into the low half, the odd lanes' shifted up into the
+     * high half.
+     */
+    template <int Q>
+    static inline V Mul(V a, int32 b)
+    {
+        __m256i vb   = _mm256_set1_epi32(b);
+        __m256i even = _mm256_mul_epi32(a, vb);
+        __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), vb);
+        return _mm256_blend_epi32(_mm256_srli_epi64(even, Q),
+                                  _mm256_slli_epi64(odd, 32 - Q),
+                                  0xAA);
+    }
+};
+
+#include "pvmp3_mdct_18_lanes.h"
+
+} // namespace avx2
+} // namespace
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+static int32 GetLanes()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return avx2::Ops::Lanes;
+    if (__builtin_cpu_supports("sse4.1"))
+        return sse41::Ops::Lanes;
+    return 0;
+}
+
+int32 pvmp3_mdct_18_simd_lanes(void)
+{
+    static const int32 lanes = GetLanes();
+    return lanes;
+}
+
+void pvmp3_mdct_18_simd(int32 vec[], int32 *history, const int32 *window)
+{
+    if (pvmp3_mdct_18_simd_lanes() == avx2::Ops::Lanes)
+        avx2::Mdct18<avx2::Ops>(vec, history, window);
+    else
+        sse41::Mdct18<sse41::Ops>(vec, history, window);
+}
+
+void pvmp3_mdct_6_simd(int32 vec[], int32 *history, const int32 *window)
+{
+    if (pvmp3_mdct_18_simd_lanes() == avx2::Ops::Lanes)
+        avx2::MdctShort<avx2::Ops>(vec, history, window);
+    else
+        sse41::MdctShort<sse41::Ops>(vec, history, window);
+}
+
+#elif defined(__aarch64__)
+
+namespace
+{
+namespace neon
+{
+
+struct Ops
+{
+    typedef int32x4_t V;
+    static const int32 Lanes = 4;
+
+    static inline V Load(const int32 *p)
+    {
+        return vld1q_s32(p);
+    }
+    static inline void Store(int32 *p, V v)
+    {
+        vst1q_s32(p, v);
+    }
+    static inline void Transpose(V r[4])
+    {
+        int32x4x2_t t01 = vtrnq_s32(r[0], r[1]);
+        int32x4x2_t t23 = vtrnq_s32(r[2], r[3]);
+        r[0] = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+        r[1] = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+        r[2] = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+        r[3] = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+    }
+    static inline V Add(V a, V b)
+    {
+        return vaddq_s32(a, b);
+    }
+    static inline V Sub(V a, V b)
+    {
+        return vsubq_s32(a, b);
+    }
+    static inline V Neg(V a)
+    {
+        return vnegq_s32(a);
+    }
+    static inline V Shl1(V a)
+    {
+        return vshlq_n_s32(a, 1);
+    }
+    static inline V Shr1(V a)
+    {
+        return vshrq_n_s32(a, 1);
+    }
+    template <int Q>
+    static inline V Mul(V a, int32 b)
+    {
+        int64x2_t lo = vmull_n_s32(vget_low_s32(a), b);
+        int64x2_t hi = vmull_high_n_s32(a, b);
+        return vcombine_s32(vshrn_n_s64(lo, Q), vshrn_n_s64(hi, Q));
+    }
+};
+
+#include "pvmp3_mdct_18_lanes.h"
+
+} // namespace neon
+} // namespace
+
+int32 pvmp3_mdct_18_simd_lanes(void)
+{
+    return neon::Ops::Lanes;
+}
+
+void pvmp3_mdct_18_simd(int32 vec[], int32 *history, const int32 *window)
+{
+    neon::Mdct18<neon::Ops>(vec, history, window);
+}
+
+void pvmp3_mdct_6_simd(int32 vec[], int32 *history, const int32 *window)
+{
+    neon::MdctShort<neon::Ops>(vec, history, window);
+}
+
+#endif
+
+#endif /* PVMP3_SIMD_IMDCT */
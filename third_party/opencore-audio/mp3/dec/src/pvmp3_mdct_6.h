@@ -63,6 +63,17 @@
 #define Qfmt1(a)   (Int32)(a*((Int32)0x7FFFFFFF))
 #define Qfmt2(a)   (Int32)(a*((Int32)1<<27))
 
+#define QFORMAT    29
+#define Qfmt29(a)   (int32)(a*((int32)1<<QFORMAT) + (a>=0?0.5F:-0.5F))
+#define Qfmt30(a)   (Int32)(a*((Int32)1<<30) + (a>=0?0.5F:-0.5F))
+
+/* pvmp3_mdct_18.h has a Q31 cos_pi_6 for pvmp3_dct_9(). */
+#define cos_pi_6_q30 Qfmt30(  0.86602540378444f)
+#define cos_2_pi_6   Qfmt30(  0.5f)
+#define cos_7_pi_12  Qfmt30( -0.25881904510252f)
+#define cos_3_pi_12  Qfmt30(  0.70710678118655f)
+#define cos_11_pi_12 Qfmt30( -0.96592582628907f)
+
 /*----------------------------------------------------------------------------
 ; EXTERNAL VARIABLES REFERENCES
 ; Declare variables used in this module but defined elsewhere
@@ -90,6 +101,8 @@ extern "C"
 #endif
 
 
+    extern const int32 cosTerms_1_ov_cos_phi_N6[6];
+
     void pvmp3_mdct_6(int32 vec[], int32 *overlap);
 
     void pvmp3_dct_6(int32 vec[]);
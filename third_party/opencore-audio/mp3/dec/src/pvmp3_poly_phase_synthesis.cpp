@@ -40,6 +40,7 @@
     int32          numChannels,       number of channels
     e_equalization equalizerType,     equalization mode
     int16          *outPcm            pointer to the PCM output data
+    float          *outPcmFloat       if not NULL, used instead of outPcm
 
   Output
     int16          *outPcm            pointer to the PCM output data
@@ -122,7 +123,8 @@
 void pvmp3_poly_phase_synthesis(tmp3dec_chan   *pChVars,
                                 int32          numChannels,
                                 e_equalization equalizerType,
-                                int16          *outPcm)
+                                int16          *outPcm,
+                                float          *outPcmFloat)
 {
     /*
      *  Equalizer
@@ -133,6 +135,7 @@ void pvmp3_poly_phase_synthesis(tmp3dec_chan   *pChVars,
 
 
     int16 * ptr_out = outPcm;
+    float * ptr_out_float = outPcmFloat;
 
 
     for (int32  band = 0; band < FILTERBANK_BANDS; band += 2)
@@ -150,9 +153,14 @@ void pvmp3_poly_phase_synthesis(tmp3dec_chan   *pChVars,
 
         pvmp3_merge_in_place_N32(inData);
 
-        pvmp3_polyphase_filter_window(inData,
-                                      ptr_out,
-                                      numChannels);
+        if (ptr_out_float)
+            pvmp3_polyphase_filter_window_float(inData,
+                                                ptr_out_float,
+                                                numChannels);
+        else
+            pvmp3_polyphase_filter_window(inData,
+                                          ptr_out,
+                                          numChannels);
 
         inData  -= SUBBANDS_NUMBER;
 
@@ -167,11 +175,19 @@ void pvmp3_poly_phase_synthesis(tmp3dec_chan   *pChVars,
 
         pvmp3_merge_in_place_N32(inData);
 
-        pvmp3_polyphase_filter_window(inData,
-                                      ptr_out + (numChannels << 5),
-                                      numChannels);
-
-        ptr_out += (numChannels << 6);
+        if (ptr_out_float)
+            pvmp3_polyphase_filter_window_float(inData,
+                                                ptr_out_float + (numChannels << 5),
+                                                numChannels);
+        else
+            pvmp3_polyphase_filter_window(inData,
+                                          ptr_out + (numChannels << 5),
+                                          numChannels);
+
+        if (ptr_out_float)
+            ptr_out_float += (numChannels << 6);
+        else
+            ptr_out += (numChannels << 6);
 
         inData  -= SUBBANDS_NUMBER;
 
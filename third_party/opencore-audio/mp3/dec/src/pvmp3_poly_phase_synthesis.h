@@ -89,7 +89,8 @@ extern "C"
     void pvmp3_poly_phase_synthesis(tmp3dec_chan   *pChVars,
                                     int32          numChannels,
                                     e_equalization equalizerType,
-                                    int16          *outPcm);
+                                    int16          *outPcm,
+                                    float          *outPcmFloat);
 
 #ifdef __cplusplus
 }
@@ -112,9 +112,25 @@ Input
 ; FUNCTION CODE
 ----------------------------------------------------------------------------*/
 
-void pvmp3_polyphase_filter_window(int32 *synth_buffer,
-                                   int16 *outPcm,
-                                   int32 numChannels)
+/*
+ * Output samples are stored through these, so the same window code
+ * can produce 16-bit or floating point PCM.  The sums carry 6 bits
+ * below the 16-bit output, plus a rounding constant of 0x20.
+ */
+static inline void store_sample(int16 *out, int32 sum)
+{
+    *out = saturate16(sum >> 6);
+}
+
+static inline void store_sample(float *out, int32 sum)
+{
+    *out = (float)(sum - 0x00000020) * (1.0f / (1 << 21));
+}
+
+template <typename T>
+static inline void polyphase_filter_window(int32 *synth_buffer,
+                                           T *outPcm,
+                                           int32 numChannels)
 {
     int32 sum1;
     int32 sum2;
@@ -122,6 +138,22 @@ void pvmp3_polyphase_filter_window(int32 *synth_buffer,
     int32 i;
 
 
+#if defined(PVMP3_SIMD_WINDOW)
+    int32 sums1[SUBBANDS_NUMBER / 2];
+    int32 sums2[SUBBANDS_NUMBER / 2];
+
+    if (pvmp3_polyphase_filter_window_simd(synth_buffer, sums1, sums2))
+    {
+        for (int16 j = 1;j < SUBBANDS_NUMBER / 2;j++)
+        {
+            int32 k = j << (numChannels - 1);
+            store_sample(&outPcm[k], sums1[j]);
+            store_sample(&outPcm[(numChannels<<5) - k], sums2[j]);
+        }
+        winPtr += (SUBBANDS_NUMBER / 2 - 1) << 4;
+    }
+    else
+#endif
     for (int16 j = 1;j < SUBBANDS_NUMBER / 2;j++)
     {
         sum1 = 0x00000020;
@@ -196,8 +228,8 @@ void pvmp3_polyphase_filter_window(int32 *synth_buffer,
 
 
         int32 k = j << (numChannels - 1);
-        outPcm[k] = saturate16(sum1 >> 6);
-        outPcm[(numChannels<<5) - k] = saturate16(sum2 >> 6);
+        store_sample(&outPcm[k], sum1);
+        store_sample(&outPcm[(numChannels<<5) - k], sum2);
     }
 
 
@@ -229,11 +261,27 @@ void pvmp3_polyphase_filter_window(int32 *synth_buffer,
     }
 
 
-    outPcm[0] = saturate16(sum1 >> 6);
-    outPcm[(SUBBANDS_NUMBER/2)<<(numChannels-1)] = saturate16(sum2 >> 6);
+    store_sample(&outPcm[0], sum1);
+    store_sample(&outPcm[(SUBBANDS_NUMBER/2)<<(numChannels-1)], sum2);
 
 
 }
 
 
+void pvmp3_polyphase_filter_window(int32 *synth_buffer,
+                                   int16 *outPcm,
+                                   int32 numChannels)
+{
+    polyphase_filter_window(synth_buffer, outPcm, numChannels);
+}
+
+
+void pvmp3_polyphase_filter_window_float(int32 *synth_buffer,
+                                         float *outPcm,
+                                         int32 numChannels)
+{
+    polyphase_filter_window(synth_buffer, outPcm, numChannels);
+}
+
+
 
@@ -122,6 +122,29 @@ extern "C"
                                        int16 *outPcm,
                                        int32 numChannels);
 
+    /*
+     * Same, but stores floating point samples scaled so that 16-bit full
+     * scale is 1.0.  They aren't rounded or clipped, so a loud enough
+     * frame can go past -1.0 or 1.0.
+     */
+    void pvmp3_polyphase_filter_window_float(int32 *synth_buffer,
+                                             float *outPcm,
+                                             int32 numChannels);
+
+    /*
+     * Vector version of the main loop of pvmp3_polyphase_filter_window().
+     * Stores the accumulators for j = 1..15 in sum1[j] and sum2[j],
+     * bit-identical to C_EQUIVALENT.  Returns false if it did nothing.
+     */
+#if defined(C_EQUIVALENT) && !defined(PVMP3_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define PVMP3_SIMD_WINDOW 1
+
+    bool pvmp3_polyphase_filter_window_simd(const int32 *synth_buffer,
+                                            int32 *sum1,
+                                            int32 *sum2);
+#endif
+
 
 #ifdef __cplusplus
 }
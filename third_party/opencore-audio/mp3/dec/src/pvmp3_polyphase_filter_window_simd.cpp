@@ -0,0 +1,317 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2008 PacketVideo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+/*
+
+   Filename: pvmp3_polyphase_filter_window_simd.cpp
+
+------------------------------------------------------------------------------
+
+ Vector versions of the first loop in pvmp3_polyphase_filter_window().
+
+ The scalar loop computes two sums for each of j = 1..15.  Each sum
+ is made of 16 products, each product truncated to its high 32 bits
+ before it is accumulated (fxp_mac32_Q32/fxp_msb32_Q32).  Here several
+ values of j are computed at once, one per lane.  Every product is still
+ truncated individually and the 32-bit accumulation wraps the same way,
+ so the sums are bit-identical to the C_EQUIVALENT code.
+
+ SSE2 is always present on x86-64; AVX2 is used if the CPU has it.
+ NEON is always present on AArch64.
+
+------------------------------------------------------------------------------
+*/
+
+#include "pvmp3_polyphase_filter_window.h"
+
+#if defined(PVMP3_SIMD_WINDOW)
+
+#include "pvmp3_dec_defs.h"
+#include "pvmp3_tables.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*----------------------------------------------------------------------------
+; DEFINES
+----------------------------------------------------------------------------*/
+
+#define WINDOW_TAPS       16
+#define WINDOW_ROWS       (SUBBANDS_NUMBER/2 - 1)
+
+/*----------------------------------------------------------------------------
+; LOCAL STORE/BUFFER/POINTER DEFINITIONS
+----------------------------------------------------------------------------*/
+
+/*
+ * pqmfSynthWin stores 16 taps for each j.  The vector code wants, for a
+ * given tap, the values for consecutive j next to each other, so keep a
+ * transposed copy: taps[tap][j-1].
+ */
+struct WindowTransposed
+{
+    int32 taps[WINDOW_TAPS][WINDOW_ROWS];
+
+    WindowTransposed()
+    {
+        for (int t = 0; t < WINDOW_TAPS; t++)
+        {
+            for (int j = 0; j < WINDOW_ROWS; j++)
+                taps[t][j] = pqmfSynthWin[j * WINDOW_TAPS + t];
+        }
+    }
+};
+
+static const WindowTransposed &GetWindowTransposed()
+{
+    static const WindowTransposed w;
+    return w;
+}
+
+#if defined(__x86_64__)
+
+/*
+ * High 32 bits of the signed 64-bit product of each lane.  SSE2 only has
+ * an unsigned 32x32->64 multiply, so correct the sign afterwards:
+ *
+ *    hi(a*b) = hi(ua*ub) - (a < 0 ? b : 0) - (b < 0 ? a : 0)   (mod 2^32)
+ */
+static inline __m128i MulHi_SSE2(__m128i a, __m128i b)
+{
+    const __m128i oddMask = _mm_set_epi32(-1, 0, -1, 0);
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    __m128i hi   = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, oddMask));
+    __m128i fix  = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                 _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi32(hi, fix);
+}
+
+/* Load src[-3..0], lane order reversed so that lane l holds src[-l]. */
+static inline __m128i LoadReversed_SSE2(const int32 *src)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)(src - 3));
+    return _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static void Window4_SSE2(const int32 *synth_buffer,
+                         int32 *sums1,
+                         int32 *sums2,
+                         int32 j0)
+{
+    const WindowTransposed &w = GetWindowTransposed();
+    const int32 *pt_1 = &synth_buffer[(SUBBANDS_NUMBER >> 1) + j0];
+    const int32 *pt_2 = &synth_buffer[(SUBBANDS_NUMBER >> 1) - j0];
+    __m128i sum1 = _mm_set1_epi32(0x00000020);
+    __m128i sum2 = _mm_set1_epi32(0x00000020);
+
+    for (int32 n = 0; n < 4; n++)
+    {
+        const int32 *win = &w.taps[n * 4][j0 - 1];
+        __m128i temp1 = _mm_loadu_si128((const __m128i *)&pt_1[SUBBANDS_NUMBER * (2 * n)]);
+        __m128i temp3 = LoadReversed_SSE2(&pt_2[SUBBANDS_NUMBER * (15 - 2 * n)]);
+        __m128i temp2 = LoadReversed_SSE2(&pt_2[SUBBANDS_NUMBER * (2 * n + 1)]);
+        __m128i temp4 = _mm_loadu_si128((const __m128i *)&pt_1[SUBBANDS_NUMBER * (14 - 2 * n)]);
+        __m128i w0 = _mm_loadu_si128((const __m128i *)&win[0 * WINDOW_ROWS]);
+        __m128i w1 = _mm_loadu_si128((const __m128i *)&win[1 * WINDOW_ROWS]);
+        __m128i w2 = _mm_loadu_si128((const __m128i *)&win[2 * WINDOW_ROWS]);
+        __m128i w3 = _mm_loadu_si128((const __m128i *)&win[3 * WINDOW_ROWS]);
+
+        sum1 = _mm_add_epi32(sum1, MulHi_SSE2(temp1, w0));
+        sum2 = _mm_add_epi32(sum2, MulHi_SSE2(temp3, w0));
+        sum2 = _mm_add_epi32(sum2, MulHi_SSE2(temp1, w1));
+        sum1 = _mm_sub_epi32(sum1, MulHi_SSE2(temp3, w1));
+        sum1 = _mm_add_epi32(sum1, MulHi_SSE2(temp2, w2));
+        sum2 = _mm_sub_epi32(sum2, MulHi_SSE2(temp4, w2));
+        sum2 = _mm_add_epi32(sum2, MulHi_SSE2(temp2, w3));
+        sum1 = _mm_add_epi32(sum1, MulHi_SSE2(temp4, w3));
+    }
+
+    _mm_storeu_si128((__m128i *)&sums1[j0], sum1);
+    _mm_storeu_si128((__m128i *)&sums2[j0], sum2);
+}
+
+static void Window_SSE2(const int32 *synth_buffer,
+                        int32 *sums1,
+                        int32 *sums2)
+{
+    /* j = 12 is computed twice; the second result is the same. */
+    Window4_SSE2(synth_buffer, sums1, sums2, 1);
+    Window4_SSE2(synth_buffer, sums1, sums2, 5);
+    Window4_SSE2(synth_buffer, sums1, sums2, 9);
+    Window4_SSE2(synth_buffer, sums1, sums2, 12);
+}
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+AVX2_TARGET
+static inline __m256i MulHi_AVX2(__m256i a, __m256i b)
+{
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+AVX2_TARGET
+static inline __m256i LoadReversed_AVX2(const int32 *src)
+{
+    const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i v = _mm256_loadu_si256((const __m256i *)(src - 7));
+    return _mm256_permutevar8x32_epi32(v, reverse);
+}
+
+AVX2_TARGET
+static void Window8_AVX2(const int32 *synth_buffer,
+                         int32 *sums1,
+                         int32 *sums2,
+                         int32 j0)
+{
+    const WindowTransposed &w = GetWindowTransposed();
+    const int32 *pt_1 = &synth_buffer[(SUBBANDS_NUMBER >> 1) + j0];
+    const int32 *pt_2 = &synth_buffer[(SUBBANDS_NUMBER >> 1) - j0];
+    __m256i sum1 = _mm256_set1_epi32(0x00000020);
+    __m256i sum2 = _mm256_set1_epi32(0x00000020);
+
+    for (int32 t = 0; t < 4; t++)
+    {
+        const int32 *win = &w.taps[t * 4][j0 - 1];
+        __m256i temp1 = _mm256_loadu_si256((const __m256i *)&pt_1[SUBBANDS_NUMBER * (2 * t)]);
+        __m256i temp3 = LoadReversed_AVX2(&pt_2[SUBBANDS_NUMBER * (15 - 2 * t)]);
+        __m256i temp2 = LoadReversed_AVX2(&pt_2[SUBBANDS_NUMBER * (2 * t + 1)]);
+        __m256i temp4 = _mm256_loadu_si256((const __m256i *)&pt_1[SUBBANDS_NUMBER * (14 - 2 * t)]);
+        __m256i w0 = _mm256_loadu_si256((const __m256i *)&win[0 * WINDOW_ROWS]);
+        __m256i w1 = _mm256_loadu_si256((const __m256i *)&win[1 * WINDOW_ROWS]);
+        __m256i w2 = _mm256_loadu_si256((const __m256i *)&win[2 * WINDOW_ROWS]);
+        __m256i w3 = _mm256_loadu_si256((const __m256i *)&win[3 * WINDOW_ROWS]);
+
+        sum1 = _mm256_add_epi32(sum1, MulHi_AVX2(temp1, w0));
+        sum2 = _mm256_add_epi32(sum2, MulHi_AVX2(temp3, w0));
+        sum2 = _mm256_add_epi32(sum2, MulHi_AVX2(temp1, w1));
+        sum1 = _mm256_sub_epi32(sum1, MulHi_AVX2(temp3, w1));
+        sum1 = _mm256_add_epi32(sum1, MulHi_AVX2(temp2, w2));
+        sum2 = _mm256_sub_epi32(sum2, MulHi_AVX2(temp4, w2));
+        sum2 = _mm256_add_epi32(sum2, MulHi_AVX2(temp2, w3));
+        sum1 = _mm256_add_epi32(sum1, MulHi_AVX2(temp4, w3));
+    }
+
+    _mm256_storeu_si256((__m256i *)&sums1[j0], sum1);
+    _mm256_storeu_si256((__m256i *)&sums2[j0], sum2);
+}
+
+AVX2_TARGET
+static void Window_AVX2(const int32 *synth_buffer,
+                        int32 *sums1,
+                        int32 *sums2)
+{
+    /*
+     * The second call covers j = 8..15.  j = 8 is computed twice; the
+     * second result is the same.
+     */
+    Window8_AVX2(synth_buffer, sums1, sums2, 1);
+    Window8_AVX2(synth_buffer, sums1, sums2, 8);
+}
+
+static bool HaveAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+bool pvmp3_polyphase_filter_window_simd(const int32 *synth_buffer,
+                                        int32 *sum1,
+                                        int32 *sum2)
+{
+    static const bool avx2 = HaveAvx2();
+
+    if (avx2)
+        Window_AVX2(synth_buffer, sum1, sum2);
+    else
+        Window_SSE2(synth_buffer, sum1, sum2);
+    return true;
+}
+
+#elif defined(__aarch64__)
+
+/* High 32 bits of the signed 64-bit product of each lane. */
+static inline int32x4_t MulHi_NEON(int32x4_t a, int32x4_t b)
+{
+    int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+    int64x2_t hi = vmull_high_s32(a, b);
+    return vcombine_s32(vshrn_n_s64(lo, 32), vshrn_n_s64(hi, 32));
+}
+
+static inline int32x4_t LoadReversed_NEON(const int32 *src)
+{
+    int32x4_t v = vrev64q_s32(vld1q_s32(src - 3));
+    return vcombine_s32(vget_high_s32(v), vget_low_s32(v));
+}
+
+static void Window4_NEON(const int32 *synth_buffer,
+                         int32 *sums1,
+                         int32 *sums2,
+                         int32 j0)
+{
+    const WindowTransposed &w = GetWindowTransposed();
+    const int32 *pt_1 = &synth_buffer[(SUBBANDS_NUMBER >> 1) + j0];
+    const int32 *pt_2 = &synth_buffer[(SUBBANDS_NUMBER >> 1) - j0];
+    int32x4_t sum1 = vdupq_n_s32(0x00000020);
+    int32x4_t sum2 = vdupq_n_s32(0x00000020);
+
+    for (int32 n = 0; n < 4; n++)
+    {
+        const int32 *win = &w.taps[n * 4][j0 - 1];
+        int32x4_t temp1 = vld1q_s32(&pt_1[SUBBANDS_NUMBER * (2 * n)]);
+        int32x4_t temp3 = LoadReversed_NEON(&pt_2[SUBBANDS_NUMBER * (15 - 2 * n)]);
+        int32x4_t temp2 = LoadReversed_NEON(&pt_2[SUBBANDS_NUMBER * (2 * n + 1)]);
+        int32x4_t temp4 = vld1q_s32(&pt_1[SUBBANDS_NUMBER * (14 - 2 * n)]);
+        int32x4_t w0 = vld1q_s32(&win[0 * WINDOW_ROWS]);
+        int32x4_t w1 = vld1q_s32(&win[1 * WINDOW_ROWS]);
+        int32x4_t w2 = vld1q_s32(&win[2 * WINDOW_ROWS]);
+        int32x4_t w3 = vld1q_s32(&win[3 * WINDOW_ROWS]);
+
+        sum1 = vaddq_s32(sum1, MulHi_NEON(temp1, w0));
+        sum2 = vaddq_s32(sum2, MulHi_NEON(temp3, w0));
+        sum2 = vaddq_s32(sum2, MulHi_NEON(temp1, w1));
+        sum1 = vsubq_s32(sum1, MulHi_NEON(temp3, w1));
+        sum1 = vaddq_s32(sum1, MulHi_NEON(temp2, w2));
+        sum2 = vsubq_s32(sum2, MulHi_NEON(temp4, w2));
+        sum2 = vaddq_s32(sum2, MulHi_NEON(temp2, w3));
+        sum1 = vaddq_s32(sum1, MulHi_NEON(temp4, w3));
+    }
+
+    vst1q_s32(&sums1[j0], sum1);
+    vst1q_s32(&sums2[j0], sum2);
+}
+
+bool pvmp3_polyphase_filter_window_simd(const int32 *synth_buffer,
+                                        int32 *sum1,
+                                        int32 *sum2)
+{
+    /* j = 12 is computed twice; the second result is the same. */
+    Window4_NEON(synth_buffer, sum1, sum2, 1);
+    Window4_NEON(synth_buffer, sum1, sum2, 5);
+    Window4_NEON(synth_buffer, sum1, sum2, 9);
+    Window4_NEON(synth_buffer, sum1, sum2, 12);
+    return true;
+}
+
+#endif
+
+#endif /* PVMP3_SIMD_WINDOW */